@@ -3,5 +3,10 @@
 
 #include "mini_stl/algorithm/mini_algorithm_base.h"
 #include "mini_stl/algorithm/mini_algorithm_heap.h"
+#include "mini_stl/algorithm/mini_algorithm_merge.h"
+#include "mini_stl/algorithm/mini_algorithm_numeric.h"
+#include "mini_stl/algorithm/mini_algorithm_radix_sort.h"
+#include "mini_stl/algorithm/mini_algorithm_search.h"
+#include "mini_stl/algorithm/mini_algorithm_sort.h"
 
 #endif
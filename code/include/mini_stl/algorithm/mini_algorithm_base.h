@@ -1,17 +1,85 @@
 #ifndef MINI_ALGORITHM_BASE_H
 #define MINI_ALGORITHM_BASE_H
 
+#include "mini_stl/algorithm/mini_algorithm_simd.h"
 #include "mini_stl/base/mini_base_type_traits.h"
 #include "mini_stl/iterator/mini_iterator_base.h"
+#include "mini_stl/iterator/mini_iterator_deque.h"
+#include "mini_stl/utility/mini_utility_base.h"
 
 #include <cstring>
+#include <type_traits>
+#include <utility>
 
 namespace mini::algo {
 
-// notes: 'associated type' is used here: T
-// Cons: this simple find algo needs to know object type T
+template<typename InputIterator, typename OutputIterator>
+OutputIterator copy(InputIterator first, InputIterator last, OutputIterator result);
+
+// Segmented overloads for deque iterators.
+// A deque range is a sequence of contiguous buffers: these overloads walk it buffer by buffer
+// and hand each buffer to the raw pointer version, which may use memmove/memset/memcmp.
+// Declared up front so that every algorithm below can pick them up.
+
+template<typename T, typename Ref, typename Ptr, size_t BufSiz, typename BufPolicy,
+    typename OutputIterator>
+OutputIterator copy(iter::__deque_iterator<T, Ref, Ptr, BufSiz, BufPolicy> first,
+    iter::__deque_iterator<T, Ref, Ptr, BufSiz, BufPolicy> last, OutputIterator result);
+
+template<typename InputIterator, typename T, size_t BufSiz, typename BufPolicy>
+iter::__deque_iterator<T, T&, T*, BufSiz, BufPolicy> copy(
+    InputIterator first, InputIterator last,
+    iter::__deque_iterator<T, T&, T*, BufSiz, BufPolicy> result);
+
+template<typename T, typename Ref, typename Ptr, size_t BufSiz, typename BufPolicy>
+iter::__deque_iterator<T, T&, T*, BufSiz, BufPolicy> copy(
+    iter::__deque_iterator<T, Ref, Ptr, BufSiz, BufPolicy> first,
+    iter::__deque_iterator<T, Ref, Ptr, BufSiz, BufPolicy> last,
+    iter::__deque_iterator<T, T&, T*, BufSiz, BufPolicy> result);
+
+template<typename T, typename Ref, typename Ptr, size_t BufSiz, typename BufPolicy,
+    typename BidirIt2>
+BidirIt2 copy_backward(iter::__deque_iterator<T, Ref, Ptr, BufSiz, BufPolicy> first,
+    iter::__deque_iterator<T, Ref, Ptr, BufSiz, BufPolicy> last, BidirIt2 d_last);
+
+template<typename BidirIt1, typename T, size_t BufSiz, typename BufPolicy>
+iter::__deque_iterator<T, T&, T*, BufSiz, BufPolicy> copy_backward(
+    BidirIt1 first, BidirIt1 last, iter::__deque_iterator<T, T&, T*, BufSiz, BufPolicy> d_last);
+
+template<typename T, typename Ref, typename Ptr, size_t BufSiz, typename BufPolicy>
+iter::__deque_iterator<T, T&, T*, BufSiz, BufPolicy> copy_backward(
+    iter::__deque_iterator<T, Ref, Ptr, BufSiz, BufPolicy> first,
+    iter::__deque_iterator<T, Ref, Ptr, BufSiz, BufPolicy> last,
+    iter::__deque_iterator<T, T&, T*, BufSiz, BufPolicy> d_last);
+
+template<typename T, size_t BufSiz, typename BufPolicy, typename U>
+void fill(iter::__deque_iterator<T, T&, T*, BufSiz, BufPolicy> first,
+    iter::__deque_iterator<T, T&, T*, BufSiz, BufPolicy> last, const U& value);
+
+template<typename T, typename Ref, typename Ptr, size_t BufSiz, typename BufPolicy,
+    typename InputIterator2>
+bool equal(iter::__deque_iterator<T, Ref, Ptr, BufSiz, BufPolicy> first1,
+    iter::__deque_iterator<T, Ref, Ptr, BufSiz, BufPolicy> last1, InputIterator2 first2);
+
+template<typename T, typename Ref, typename Ptr, size_t BufSiz, typename BufPolicy,
+    typename U>
+iter::__deque_iterator<T, Ref, Ptr, BufSiz, BufPolicy> find(
+    iter::__deque_iterator<T, Ref, Ptr, BufSiz, BufPolicy> first,
+    iter::__deque_iterator<T, Ref, Ptr, BufSiz, BufPolicy> last, const U& value);
+
+template<typename T, typename Ref, typename Ptr, size_t BufSiz, typename BufPolicy,
+    typename U>
+ptrdiff_t count(iter::__deque_iterator<T, Ref, Ptr, BufSiz, BufPolicy> first,
+    iter::__deque_iterator<T, Ref, Ptr, BufSiz, BufPolicy> last, const U& value);
+
+template<typename T, typename Ref, typename Ptr, size_t BufSiz, typename BufPolicy,
+    typename Function>
+iter::__deque_iterator<T, Ref, Ptr, BufSiz, BufPolicy> for_each(
+    iter::__deque_iterator<T, Ref, Ptr, BufSiz, BufPolicy> first,
+    iter::__deque_iterator<T, Ref, Ptr, BufSiz, BufPolicy> last, Function&& func);
+
 template<typename InputIterator, typename T>
-InputIterator find(InputIterator first, InputIterator last, const T& value)
+inline InputIterator __find(InputIterator first, InputIterator last, const T& value)
 {
     while (first != last && (*first) != value) {
         ++first;
@@ -19,8 +87,134 @@ InputIterator find(InputIterator first, InputIterator last, const T& value)
     return first;
 }
 
+template<typename InputIterator, typename T>
+struct __find_dispatch {
+    InputIterator operator()(InputIterator first, InputIterator last, const T& value)
+    {
+        return mini::algo::__find(first, last, value);
+    }
+};
+
+// contiguous arithmetic elements: vectorized scan
+template<typename T, typename U>
+struct __find_dispatch<T*, U> {
+    T* operator()(T* first, T* last, const U& value)
+    {
+        typedef std::remove_cv_t<T> value_type;
+        if constexpr (__simd_scannable_v<value_type>) {
+            value_type key;
+            if (__simd_key(value, key)) {
+                return first + __simd_find<value_type>(first, size_t(last - first), key);
+            }
+        }
+        return mini::algo::__find(first, last, value);
+    }
+};
+
+// notes: 'associated type' is used here: T
+// Cons: this simple find algo needs to know object type T
+template<typename InputIterator, typename T>
+InputIterator find(InputIterator first, InputIterator last, const T& value)
+{
+    return __find_dispatch<InputIterator, T>()(first, last, value);
+}
+
+// Find in a deque range: a tight pointer loop per buffer instead of a boundary check per step
+template<typename T, typename Ref, typename Ptr, size_t BufSiz, typename BufPolicy,
+    typename U>
+iter::__deque_iterator<T, Ref, Ptr, BufSiz, BufPolicy> find(
+    iter::__deque_iterator<T, Ref, Ptr, BufSiz, BufPolicy> first,
+    iter::__deque_iterator<T, Ref, Ptr, BufSiz, BufPolicy> last, const U& value)
+{
+    typedef iter::__deque_iterator<T, Ref, Ptr, BufSiz, BufPolicy> deque_iterator;
+    if (first.node == last.node) {
+        first.cur = find(first.cur, last.cur, value);
+        return first;
+    }
+    T* pos = find(first.cur, first.last, value);
+    if (pos != first.last) {
+        first.cur = pos;
+        return first;
+    }
+    for (typename deque_iterator::map_pointer node = first.node + 1; node != last.node; ++node) {
+        T* buffer_end = *node + deque_iterator::buffer_size();
+        pos = find(*node, buffer_end, value);
+        if (pos != buffer_end) {
+            first.set_node(node);
+            first.cur = pos;
+            return first;
+        }
+    }
+    last.cur = find(last.first, last.cur, value);
+    return last;
+}
+
+template<typename InputIterator, typename T>
+inline typename iter::iterator_traits<InputIterator>::difference_type __count(
+    InputIterator first, InputIterator last, const T& value)
+{
+    typename iter::iterator_traits<InputIterator>::difference_type n = 0;
+    for (; first != last; ++first) {
+        if (*first == value) {
+            ++n;
+        }
+    }
+    return n;
+}
+
+template<typename InputIterator, typename T>
+struct __count_dispatch {
+    typename iter::iterator_traits<InputIterator>::difference_type operator()(
+        InputIterator first, InputIterator last, const T& value)
+    {
+        return mini::algo::__count(first, last, value);
+    }
+};
+
+// contiguous arithmetic elements: vectorized scan
+template<typename T, typename U>
+struct __count_dispatch<T*, U> {
+    ptrdiff_t operator()(T* first, T* last, const U& value)
+    {
+        typedef std::remove_cv_t<T> value_type;
+        if constexpr (__simd_scannable_v<value_type>) {
+            value_type key;
+            if (__simd_key(value, key)) {
+                return ptrdiff_t(__simd_count<value_type>(first, size_t(last - first), key));
+            }
+        }
+        return mini::algo::__count(first, last, value);
+    }
+};
+
+template<typename InputIterator, typename T>
+typename iter::iterator_traits<InputIterator>::difference_type count(
+    InputIterator first, InputIterator last, const T& value)
+{
+    return __count_dispatch<InputIterator, T>()(first, last, value);
+}
+
+// Count in a deque range buffer by buffer
+template<typename T, typename Ref, typename Ptr, size_t BufSiz, typename BufPolicy,
+    typename U>
+ptrdiff_t count(iter::__deque_iterator<T, Ref, Ptr, BufSiz, BufPolicy> first,
+    iter::__deque_iterator<T, Ref, Ptr, BufSiz, BufPolicy> last, const U& value)
+{
+    typedef iter::__deque_iterator<T, Ref, Ptr, BufSiz, BufPolicy> deque_iterator;
+    if (first.node == last.node) {
+        return count(first.cur, last.cur, value);
+    }
+    ptrdiff_t n = count(first.cur, first.last, value);
+    for (typename deque_iterator::map_pointer node = first.node + 1; node != last.node; ++node) {
+        n += count(*node, *node + deque_iterator::buffer_size(), value);
+    }
+    return n + count(last.first, last.cur, value);
+}
+
+// 'func' is taken by forwarding reference: a stateful function object passed as an lvalue
+// is updated in place, a temporary (e.g. a lambda) is accepted as well.
 template<typename InputIterator, typename Function>
-InputIterator for_each(InputIterator first, InputIterator last, Function& func)
+InputIterator for_each(InputIterator first, InputIterator last, Function&& func)
 {
     for (; first != last; ++first) {
         func(*first);
@@ -28,6 +222,56 @@ InputIterator for_each(InputIterator first, InputIterator last, Function& func)
     return first;
 }
 
+// Apply to a deque range buffer by buffer
+template<typename T, typename Ref, typename Ptr, size_t BufSiz, typename BufPolicy,
+    typename Function>
+iter::__deque_iterator<T, Ref, Ptr, BufSiz, BufPolicy> for_each(
+    iter::__deque_iterator<T, Ref, Ptr, BufSiz, BufPolicy> first,
+    iter::__deque_iterator<T, Ref, Ptr, BufSiz, BufPolicy> last, Function&& func)
+{
+    typedef iter::__deque_iterator<T, Ref, Ptr, BufSiz, BufPolicy> deque_iterator;
+    if (first.node == last.node) {
+        for_each(first.cur, last.cur, func);
+        return last;
+    }
+    for_each(first.cur, first.last, func);
+    for (typename deque_iterator::map_pointer node = first.node + 1; node != last.node; ++node) {
+        for_each(*node, *node + deque_iterator::buffer_size(), func);
+    }
+    for_each(last.first, last.cur, func);
+    return last;
+}
+
+/**
+ * @brief Store op(*it) for each element of [first, last) to the range beginning at 'result'.
+ *
+ * @return OutputIterator End of the output range
+ */
+template<typename InputIterator, typename OutputIterator, typename UnaryOperation>
+OutputIterator transform(
+    InputIterator first, InputIterator last, OutputIterator result, UnaryOperation op)
+{
+    for (; first != last; ++first, ++result) {
+        *result = op(*first);
+    }
+    return result;
+}
+
+/**
+ * @brief Store op(*it1, *it2) for each pair of elements of [first1, last1) and the range
+ *        beginning at 'first2' to the range beginning at 'result'.
+ */
+template<typename InputIterator1, typename InputIterator2, typename OutputIterator,
+    typename BinaryOperation>
+OutputIterator transform(InputIterator1 first1, InputIterator1 last1, InputIterator2 first2,
+    OutputIterator result, BinaryOperation op)
+{
+    for (; first1 != last1; ++first1, ++first2, ++result) {
+        *result = op(*first1, *first2);
+    }
+    return result;
+}
+
 //// copy() begin ////
 
 // Version 1: input iterator
@@ -60,11 +304,48 @@ inline OutputIterator __copy(RandomAccessIterator first, RandomAccessIterator la
     return __copy_d(first, last, result, iter::distance_type(first));
 }
 
+// Version 3: contiguous iterator
+// Native pointers: plain indexed loop (same-type pointer pairs never reach here, see
+// __copy_dispatch below)
+template<typename T, typename OutputIterator>
+inline OutputIterator __copy_contiguous(T* first, T* last, OutputIterator result)
+{
+    return __copy_d(first, last, result, (ptrdiff_t*)0);
+}
+
+// Other contiguous iterators: unwrap to raw pointers, so that a pointer destination is memmove'd
+template<typename ContiguousIterator, typename OutputIterator>
+inline OutputIterator __copy_contiguous(
+    ContiguousIterator first, ContiguousIterator last, OutputIterator result)
+{
+    if (first == last) {
+        return result;
+    }
+    auto p = iter::__to_address(first);
+    return copy(p, p + (last - first), result);
+}
+
+template<typename ContiguousIterator, typename OutputIterator>
+inline OutputIterator __copy(ContiguousIterator first, ContiguousIterator last,
+    OutputIterator result, iter::contiguous_iterator_tag)
+{
+    return __copy_contiguous(first, last, result);
+}
+
+// memmove is only valid on trivially copyable types: a trivial copy assignment alone does not
+// make the bytes of an object safe to duplicate, e.g. with a user-provided destructor
+template<typename T>
+using __memmove_assignable = typename type_traits::__bool_type<std::is_trivially_copyable<T>::value
+    && std::is_trivially_copy_assignable<T>::value>::type;
+
 template<typename T>
 inline T* __copy_t(const T* first, const T* last, T* result, type_traits::__true_type)
 {
-    memmove(result, first, sizeof(T) * (last - first));
-    return result + (last - first);
+    const ptrdiff_t n = last - first;
+    if (n > 0) {
+        memmove(result, first, sizeof(T) * n);
+    }
+    return result + n;
 }
 
 template<typename T>
@@ -86,7 +367,7 @@ template<typename T>
 struct __copy_dispatch<T*, T*> {
     T* operator()(T* first, T* last, T* result)
     {
-        using t = typename type_traits::__type_traits<T>::has_trivial_assignment_operator;
+        using t = __memmove_assignable<T>;
         return __copy_t(first, last, result, t());
     }
 };
@@ -96,7 +377,7 @@ template<typename T>
 struct __copy_dispatch<const T*, T*> {
     T* operator()(const T* first, const T* last, T* result)
     {
-        using t = typename type_traits::__type_traits<T>::has_trivial_assignment_operator;
+        using t = __memmove_assignable<T>;
         return __copy_t(first, last, result, t());
     }
 };
@@ -122,10 +403,87 @@ inline wchar_t* copy(const wchar_t* first, const wchar_t* last, wchar_t* result)
     return result + (last - first);  // shift backward, no need deal with sizeof(wchar_t)
 }
 
-//// copy() begin ////
+// Source range is a deque: one copy per source buffer
+template<typename T, typename Ref, typename Ptr, size_t BufSiz, typename BufPolicy,
+    typename OutputIterator>
+OutputIterator copy(iter::__deque_iterator<T, Ref, Ptr, BufSiz, BufPolicy> first,
+    iter::__deque_iterator<T, Ref, Ptr, BufSiz, BufPolicy> last, OutputIterator result)
+{
+    typedef iter::__deque_iterator<T, Ref, Ptr, BufSiz, BufPolicy> deque_iterator;
+    if (first.node == last.node) {
+        return copy(first.cur, last.cur, result);
+    }
+    result = copy(first.cur, first.last, result);
+    for (typename deque_iterator::map_pointer node = first.node + 1; node != last.node; ++node) {
+        result = copy(*node, *node + deque_iterator::buffer_size(), result);
+    }
+    return copy(last.first, last.cur, result);
+}
+
+// Destination range is a deque: one copy per destination buffer if the source is random access
+template<typename InputIterator, typename T, size_t BufSiz, typename BufPolicy>
+inline iter::__deque_iterator<T, T&, T*, BufSiz, BufPolicy> __copy_to_deque(InputIterator first,
+    InputIterator last, iter::__deque_iterator<T, T&, T*, BufSiz, BufPolicy> result,
+    iter::input_iterator_tag)
+{
+    for (; first != last; ++result, ++first) {
+        *result = *first;
+    }
+    return result;
+}
+
+template<typename RandomAccessIterator, typename T, size_t BufSiz, typename BufPolicy>
+inline iter::__deque_iterator<T, T&, T*, BufSiz, BufPolicy> __copy_to_deque(
+    RandomAccessIterator first, RandomAccessIterator last,
+    iter::__deque_iterator<T, T&, T*, BufSiz, BufPolicy> result, iter::random_access_iterator_tag)
+{
+    typedef typename iter::iterator_traits<RandomAccessIterator>::difference_type Distance;
+    for (Distance n = last - first; n > 0;) {
+        // number of slots left in the current destination buffer
+        Distance chunk = result.last - result.cur;
+        if (chunk > n) {
+            chunk = n;
+        }
+        copy(first, first + chunk, result.cur);
+        first += chunk;
+        result += chunk;
+        n -= chunk;
+    }
+    return result;
+}
+
+template<typename InputIterator, typename T, size_t BufSiz, typename BufPolicy>
+iter::__deque_iterator<T, T&, T*, BufSiz, BufPolicy> copy(
+    InputIterator first, InputIterator last,
+    iter::__deque_iterator<T, T&, T*, BufSiz, BufPolicy> result)
+{
+    return __copy_to_deque(first, last, result, iter::iterator_category(first));
+}
+
+// Both ranges are deques: source buffers are split at destination buffer boundaries
+template<typename T, typename Ref, typename Ptr, size_t BufSiz, typename BufPolicy>
+iter::__deque_iterator<T, T&, T*, BufSiz, BufPolicy> copy(
+    iter::__deque_iterator<T, Ref, Ptr, BufSiz, BufPolicy> first,
+    iter::__deque_iterator<T, Ref, Ptr, BufSiz, BufPolicy> last,
+    iter::__deque_iterator<T, T&, T*, BufSiz, BufPolicy> result)
+{
+    typedef iter::__deque_iterator<T, Ref, Ptr, BufSiz, BufPolicy> deque_iterator;
+    if (first.node == last.node) {
+        return copy(first.cur, last.cur, result);
+    }
+    result = copy(first.cur, first.last, result);
+    for (typename deque_iterator::map_pointer node = first.node + 1; node != last.node; ++node) {
+        result = copy(*node, *node + deque_iterator::buffer_size(), result);
+    }
+    return copy(last.first, last.cur, result);
+}
+
+//// copy() end ////
+
+//// copy_backward() begin ////
 
 template<typename BidirIt1, typename BidirIt2>
-BidirIt2 copy_backward(BidirIt1 first, BidirIt1 last, BidirIt2 d_last)
+inline BidirIt2 __copy_backward(BidirIt1 first, BidirIt1 last, BidirIt2 d_last)
 {
     while (first != last) {
         *(--d_last) = *(--last);
@@ -133,6 +491,526 @@ BidirIt2 copy_backward(BidirIt1 first, BidirIt1 last, BidirIt2 d_last)
     return d_last;
 }
 
+template<typename T>
+inline T* __copy_backward_t(const T* first, const T* last, T* d_last, type_traits::__true_type)
+{
+    const ptrdiff_t n = last - first;
+    if (n > 0) {
+        memmove(d_last - n, first, sizeof(T) * n);
+    }
+    return d_last - n;
+}
+
+template<typename T>
+inline T* __copy_backward_t(const T* first, const T* last, T* d_last, type_traits::__false_type)
+{
+    return __copy_backward(first, last, d_last);
+}
+
+template<typename BidirIt1, typename BidirIt2>
+struct __copy_backward_dispatch {
+    BidirIt2 operator()(BidirIt1 first, BidirIt1 last, BidirIt2 d_last)
+    {
+        return __copy_backward(first, last, d_last);
+    }
+};
+
+template<typename T>
+struct __copy_backward_dispatch<T*, T*> {
+    T* operator()(T* first, T* last, T* d_last)
+    {
+        using t = __memmove_assignable<T>;
+        return __copy_backward_t(first, last, d_last, t());
+    }
+};
+
+template<typename T>
+struct __copy_backward_dispatch<const T*, T*> {
+    T* operator()(const T* first, const T* last, T* d_last)
+    {
+        using t = __memmove_assignable<T>;
+        return __copy_backward_t(first, last, d_last, t());
+    }
+};
+
+template<typename BidirIt1, typename BidirIt2>
+BidirIt2 copy_backward(BidirIt1 first, BidirIt1 last, BidirIt2 d_last)
+{
+    return __copy_backward_dispatch<BidirIt1, BidirIt2>()(first, last, d_last);
+}
+
+// Source range is a deque: one copy_backward per source buffer, last buffer first
+template<typename T, typename Ref, typename Ptr, size_t BufSiz, typename BufPolicy,
+    typename BidirIt2>
+BidirIt2 copy_backward(iter::__deque_iterator<T, Ref, Ptr, BufSiz, BufPolicy> first,
+    iter::__deque_iterator<T, Ref, Ptr, BufSiz, BufPolicy> last, BidirIt2 d_last)
+{
+    typedef iter::__deque_iterator<T, Ref, Ptr, BufSiz, BufPolicy> deque_iterator;
+    if (first.node == last.node) {
+        return copy_backward(first.cur, last.cur, d_last);
+    }
+    d_last = copy_backward(last.first, last.cur, d_last);
+    for (typename deque_iterator::map_pointer node = last.node - 1; node != first.node; --node) {
+        d_last = copy_backward(*node, *node + deque_iterator::buffer_size(), d_last);
+    }
+    return copy_backward(first.cur, first.last, d_last);
+}
+
+// Destination range is a deque: one copy_backward per destination buffer
+template<typename BidirIt1, typename T, size_t BufSiz, typename BufPolicy>
+inline iter::__deque_iterator<T, T&, T*, BufSiz, BufPolicy> __copy_backward_to_deque(BidirIt1 first,
+    BidirIt1 last, iter::__deque_iterator<T, T&, T*, BufSiz, BufPolicy> d_last,
+    iter::bidirectional_iterator_tag)
+{
+    return __copy_backward(first, last, d_last);
+}
+
+template<typename RandomAccessIterator, typename T, size_t BufSiz, typename BufPolicy>
+inline iter::__deque_iterator<T, T&, T*, BufSiz, BufPolicy> __copy_backward_to_deque(
+    RandomAccessIterator first, RandomAccessIterator last,
+    iter::__deque_iterator<T, T&, T*, BufSiz, BufPolicy> d_last, iter::random_access_iterator_tag)
+{
+    typedef iter::__deque_iterator<T, T&, T*, BufSiz, BufPolicy> deque_iterator;
+    typedef typename iter::iterator_traits<RandomAccessIterator>::difference_type Distance;
+    for (Distance n = last - first; n > 0;) {
+        // number of slots before d_last in its buffer; an iterator sitting at the start of a
+        // buffer writes into the tail of the previous buffer
+        Distance chunk = d_last.cur - d_last.first;
+        T* buffer_end = d_last.cur;
+        if (chunk == 0) {
+            chunk = Distance(deque_iterator::buffer_size());
+            buffer_end = *(d_last.node - 1) + chunk;
+        }
+        if (chunk > n) {
+            chunk = n;
+        }
+        copy_backward(last - chunk, last, buffer_end);
+        last -= chunk;
+        d_last -= chunk;
+        n -= chunk;
+    }
+    return d_last;
+}
+
+template<typename BidirIt1, typename T, size_t BufSiz, typename BufPolicy>
+iter::__deque_iterator<T, T&, T*, BufSiz, BufPolicy> copy_backward(
+    BidirIt1 first, BidirIt1 last, iter::__deque_iterator<T, T&, T*, BufSiz, BufPolicy> d_last)
+{
+    return __copy_backward_to_deque(first, last, d_last, iter::iterator_category(first));
+}
+
+// Both ranges are deques
+template<typename T, typename Ref, typename Ptr, size_t BufSiz, typename BufPolicy>
+iter::__deque_iterator<T, T&, T*, BufSiz, BufPolicy> copy_backward(
+    iter::__deque_iterator<T, Ref, Ptr, BufSiz, BufPolicy> first,
+    iter::__deque_iterator<T, Ref, Ptr, BufSiz, BufPolicy> last,
+    iter::__deque_iterator<T, T&, T*, BufSiz, BufPolicy> d_last)
+{
+    typedef iter::__deque_iterator<T, Ref, Ptr, BufSiz, BufPolicy> deque_iterator;
+    if (first.node == last.node) {
+        return copy_backward(first.cur, last.cur, d_last);
+    }
+    d_last = copy_backward(last.first, last.cur, d_last);
+    for (typename deque_iterator::map_pointer node = last.node - 1; node != first.node; --node) {
+        d_last = copy_backward(*node, *node + deque_iterator::buffer_size(), d_last);
+    }
+    return copy_backward(first.cur, first.last, d_last);
+}
+
+//// copy_backward() end ////
+
+//// move() begin ////
+
+// Trivially copyable elements: moving is copying, which keeps the memmove and segmented deque
+// paths of copy()/copy_backward()
+template<typename InputIterator, typename OutputIterator>
+OutputIterator move(InputIterator first, InputIterator last, OutputIterator result)
+{
+    typedef typename iter::iterator_traits<InputIterator>::value_type T;
+    if constexpr (std::is_trivially_copyable<T>::value) {
+        return mini::algo::copy(first, last, result);
+    } else {
+        for (; first != last; ++first, ++result) {
+            *result = std::move(*first);
+        }
+        return result;
+    }
+}
+
+template<typename BidirIt1, typename BidirIt2>
+BidirIt2 move_backward(BidirIt1 first, BidirIt1 last, BidirIt2 d_last)
+{
+    typedef typename iter::iterator_traits<BidirIt1>::value_type T;
+    if constexpr (std::is_trivially_copyable<T>::value) {
+        return mini::algo::copy_backward(first, last, d_last);
+    } else {
+        while (first != last) {
+            *(--d_last) = std::move(*(--last));
+        }
+        return d_last;
+    }
+}
+
+//// move() end ////
+
+// Swap the elements two iterators refer to, found by ADL so that a type's own swap() is used
+template<typename ForwardIterator1, typename ForwardIterator2>
+inline void iter_swap(ForwardIterator1 a, ForwardIterator2 b)
+{
+    using std::swap;
+    swap(*a, *b);
+}
+
+//// fill() begin ////
+
+template<typename ForwardIterator, typename T>
+inline void __fill(
+    ForwardIterator first, ForwardIterator last, const T& value, iter::forward_iterator_tag)
+{
+    for (; first != last; ++first) {
+        *first = value;
+    }
+}
+
+template<typename RandomAccessIterator, typename T>
+inline void __fill(RandomAccessIterator first, RandomAccessIterator last, const T& value,
+    iter::random_access_iterator_tag)
+{
+    typedef typename iter::iterator_traits<RandomAccessIterator>::difference_type Distance;
+    for (Distance n = last - first; n > 0; --n, ++first) {
+        *first = value;
+    }
+}
+
+// contiguous iterators are filled through raw pointers
+template<typename ContiguousIterator, typename T>
+inline void __fill(ContiguousIterator first, ContiguousIterator last, const T& value,
+    iter::contiguous_iterator_tag)
+{
+    if (first == last) {
+        return;
+    }
+    auto p = iter::__to_address(first);
+    for (auto end = p + (last - first); p != end; ++p) {
+        *p = value;
+    }
+}
+
+template<typename ForwardIterator, typename T>
+void fill(ForwardIterator first, ForwardIterator last, const T& value)
+{
+    __fill(first, last, value, iter::iterator_category(first));
+}
+
+// Special version for byte pointers
+inline void fill(char* first, char* last, const char& value)
+{
+    std::memset(first, static_cast<unsigned char>(value), last - first);
+}
+
+inline void fill(signed char* first, signed char* last, const signed char& value)
+{
+    std::memset(first, static_cast<unsigned char>(value), last - first);
+}
+
+inline void fill(unsigned char* first, unsigned char* last, const unsigned char& value)
+{
+    std::memset(first, value, last - first);
+}
+
+// Fill a deque range buffer by buffer
+template<typename T, size_t BufSiz, typename BufPolicy, typename U>
+void fill(iter::__deque_iterator<T, T&, T*, BufSiz, BufPolicy> first,
+    iter::__deque_iterator<T, T&, T*, BufSiz, BufPolicy> last, const U& value)
+{
+    typedef iter::__deque_iterator<T, T&, T*, BufSiz, BufPolicy> deque_iterator;
+    if (first.node == last.node) {
+        fill(first.cur, last.cur, value);
+        return;
+    }
+    fill(first.cur, first.last, value);
+    for (typename deque_iterator::map_pointer node = first.node + 1; node != last.node; ++node) {
+        fill(*node, *node + deque_iterator::buffer_size(), value);
+    }
+    fill(last.first, last.cur, value);
+}
+
+template<typename OutputIterator, typename Size, typename T>
+inline OutputIterator __fill_n(
+    OutputIterator first, Size n, const T& value, iter::input_iterator_tag)
+{
+    for (; n > 0; --n, ++first) {
+        *first = value;
+    }
+    return first;
+}
+
+template<typename RandomAccessIterator, typename Size, typename T>
+inline RandomAccessIterator __fill_n(
+    RandomAccessIterator first, Size n, const T& value, iter::random_access_iterator_tag)
+{
+    if (n <= 0) {
+        return first;
+    }
+    RandomAccessIterator last = first + n;
+    fill(first, last, value);
+    return last;
+}
+
+template<typename OutputIterator, typename Size, typename T>
+OutputIterator fill_n(OutputIterator first, Size n, const T& value)
+{
+    return __fill_n(first, n, value, iter::iterator_category(first));
+}
+
+//// fill() end ////
+
+//// equal() begin ////
+
+template<typename InputIterator1, typename InputIterator2>
+inline bool __equal(InputIterator1 first1, InputIterator1 last1, InputIterator2 first2)
+{
+    for (; first1 != last1; ++first1, ++first2) {
+        if (!(*first1 == *first2)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// value representation equals value: compare bytes
+template<typename T>
+inline bool __equal_t(const T* first1, const T* last1, const T* first2, type_traits::__true_type)
+{
+    const ptrdiff_t n = last1 - first1;
+    return n <= 0 || std::memcmp(first1, first2, sizeof(T) * n) == 0;
+}
+
+template<typename T>
+inline bool __equal_t(const T* first1, const T* last1, const T* first2, type_traits::__false_type)
+{
+    return __equal(first1, last1, first2);
+}
+
+template<typename InputIterator1, typename InputIterator2>
+struct __equal_dispatch {
+    bool operator()(InputIterator1 first1, InputIterator1 last1, InputIterator2 first2)
+    {
+        return __equal(first1, last1, first2);
+    }
+};
+
+// pointers to the same integral or pointer type: two elements are equal iff their bytes are
+// (floating point types are excluded: +0.0 == -0.0 and NaN != NaN, they are compared lane by
+// lane by the vectorized mismatch scan instead)
+template<typename T1, typename T2>
+struct __equal_dispatch<T1*, T2*> {
+    bool operator()(T1* first1, T1* last1, T2* first2)
+    {
+        typedef std::remove_cv_t<T1> value_type;
+        if constexpr (!std::is_same_v<value_type, std::remove_cv_t<T2>>) {
+            return __equal(first1, last1, first2);
+        } else if constexpr (std::is_floating_point_v<value_type>
+                             && __simd_scannable_v<value_type>) {
+            const size_t n = size_t(last1 - first1);
+            return __simd_mismatch<value_type>(first1, first2, n) == n;
+        } else {
+            typedef typename type_traits::__bool_type<std::is_integral<value_type>::value
+                || std::is_pointer<value_type>::value>::type bytewise;
+            return __equal_t<value_type>(first1, last1, first2, bytewise());
+        }
+    }
+};
+
+template<typename InputIterator1, typename InputIterator2>
+bool equal(InputIterator1 first1, InputIterator1 last1, InputIterator2 first2)
+{
+    return __equal_dispatch<InputIterator1, InputIterator2>()(first1, last1, first2);
+}
+
+// First range is a deque: compare buffer by buffer
+template<typename T, typename Ref, typename Ptr, size_t BufSiz, typename BufPolicy,
+    typename InputIterator2>
+bool equal(iter::__deque_iterator<T, Ref, Ptr, BufSiz, BufPolicy> first1,
+    iter::__deque_iterator<T, Ref, Ptr, BufSiz, BufPolicy> last1, InputIterator2 first2)
+{
+    typedef iter::__deque_iterator<T, Ref, Ptr, BufSiz, BufPolicy> deque_iterator;
+    if (first1.node == last1.node) {
+        return equal(first1.cur, last1.cur, first2);
+    }
+    if (!equal(first1.cur, first1.last, first2)) {
+        return false;
+    }
+    iter::advance(first2, first1.last - first1.cur);
+    for (typename deque_iterator::map_pointer node = first1.node + 1; node != last1.node;
+         ++node) {
+        if (!equal(*node, *node + deque_iterator::buffer_size(), first2)) {
+            return false;
+        }
+        iter::advance(first2, deque_iterator::buffer_size());
+    }
+    return equal(last1.first, last1.cur, first2);
+}
+
+//// equal() end ////
+
+//// mismatch() begin ////
+
+template<typename InputIterator1, typename InputIterator2>
+inline util::pair<InputIterator1, InputIterator2> __mismatch(
+    InputIterator1 first1, InputIterator1 last1, InputIterator2 first2)
+{
+    while (first1 != last1 && *first1 == *first2) {
+        ++first1;
+        ++first2;
+    }
+    return util::pair<InputIterator1, InputIterator2>(first1, first2);
+}
+
+template<typename InputIterator1, typename InputIterator2>
+struct __mismatch_dispatch {
+    util::pair<InputIterator1, InputIterator2> operator()(
+        InputIterator1 first1, InputIterator1 last1, InputIterator2 first2)
+    {
+        return mini::algo::__mismatch(first1, last1, first2);
+    }
+};
+
+// pointers to the same arithmetic type: vectorized scan
+template<typename T1, typename T2>
+struct __mismatch_dispatch<T1*, T2*> {
+    util::pair<T1*, T2*> operator()(T1* first1, T1* last1, T2* first2)
+    {
+        typedef std::remove_cv_t<T1> value_type;
+        if constexpr (std::is_same_v<value_type, std::remove_cv_t<T2>>
+                      && __simd_scannable_v<value_type>) {
+            const size_t i = __simd_mismatch<value_type>(first1, first2, size_t(last1 - first1));
+            return util::pair<T1*, T2*>(first1 + i, first2 + i);
+        } else {
+            return mini::algo::__mismatch(first1, last1, first2);
+        }
+    }
+};
+
+/**
+ * @brief First position where [first1, last1) and the range starting at first2 differ.
+ *
+ * @return util::pair Iterators to the first mismatching elements, (last1, first2 + n) if none
+ */
+template<typename InputIterator1, typename InputIterator2>
+util::pair<InputIterator1, InputIterator2> mismatch(
+    InputIterator1 first1, InputIterator1 last1, InputIterator2 first2)
+{
+    return __mismatch_dispatch<InputIterator1, InputIterator2>()(first1, last1, first2);
+}
+
+template<typename InputIterator1, typename InputIterator2, typename BinaryPredicate>
+util::pair<InputIterator1, InputIterator2> mismatch(
+    InputIterator1 first1, InputIterator1 last1, InputIterator2 first2, BinaryPredicate pred)
+{
+    while (first1 != last1 && pred(*first1, *first2)) {
+        ++first1;
+        ++first2;
+    }
+    return util::pair<InputIterator1, InputIterator2>(first1, first2);
+}
+
+//// mismatch() end ////
+
+//// min_element() / max_element() begin ////
+
+template<typename ForwardIterator, typename Compare>
+ForwardIterator min_element(ForwardIterator first, ForwardIterator last, Compare comp)
+{
+    if (first == last) {
+        return first;
+    }
+    ForwardIterator result = first;
+    while (++first != last) {
+        if (comp(*first, *result)) {
+            result = first;
+        }
+    }
+    return result;
+}
+
+template<typename ForwardIterator, typename Compare>
+ForwardIterator max_element(ForwardIterator first, ForwardIterator last, Compare comp)
+{
+    if (first == last) {
+        return first;
+    }
+    ForwardIterator result = first;
+    while (++first != last) {
+        if (comp(*result, *first)) {
+            result = first;
+        }
+    }
+    return result;
+}
+
+// Ordered by operator<: the first of the smallest (Max: largest) elements
+template<bool Max, typename ForwardIterator>
+inline ForwardIterator __extremum(ForwardIterator first, ForwardIterator last)
+{
+    if (first == last) {
+        return first;
+    }
+    ForwardIterator result = first;
+    while (++first != last) {
+        if (Max ? *result < *first : *first < *result) {
+            result = first;
+        }
+    }
+    return result;
+}
+
+template<typename ForwardIterator, bool Max>
+struct __extremum_dispatch {
+    ForwardIterator operator()(ForwardIterator first, ForwardIterator last)
+    {
+        return mini::algo::__extremum<Max>(first, last);
+    }
+};
+
+// contiguous arithmetic elements: the extremum value is computed by a vectorized pass, then
+// found by a second one. Ranges holding a NaN take the scalar loop.
+template<typename T, bool Max>
+struct __extremum_dispatch<T*, Max> {
+    T* operator()(T* first, T* last)
+    {
+        typedef std::remove_cv_t<T> value_type;
+        if constexpr (__simd_scannable_v<value_type>) {
+            const size_t n = size_t(last - first);
+            value_type value;
+            if (__simd_extremum<Max>(static_cast<const value_type*>(first), n, value)) {
+                return first + __simd_find<value_type>(first, n, value);
+            }
+        }
+        return mini::algo::__extremum<Max>(first, last);
+    }
+};
+
+/**
+ * @brief First smallest element of [first, last) by operator<, last if the range is empty.
+ */
+template<typename ForwardIterator>
+ForwardIterator min_element(ForwardIterator first, ForwardIterator last)
+{
+    return __extremum_dispatch<ForwardIterator, false>()(first, last);
+}
+
+/**
+ * @brief First largest element of [first, last) by operator<, last if the range is empty.
+ */
+template<typename ForwardIterator>
+ForwardIterator max_element(ForwardIterator first, ForwardIterator last)
+{
+    return __extremum_dispatch<ForwardIterator, true>()(first, last);
+}
+
+//// min_element() / max_element() end ////
+
 }  // namespace mini::algo
 
 #endif
@@ -1,22 +1,32 @@
 #ifndef MINI_ALGORITHM_HEAP_H
 #define MINI_ALGORITHM_HEAP_H
 
+#include "mini_stl/functional/mini_functional_relational.h"
 #include "mini_stl/iterator/mini_iterator_base.h"
+#include "mini_stl/memory/mini_memory_alloc.h"
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
 
 namespace mini::algo {
 
-template<typename RandomAccessIterator, typename Distance, typename T>
-void __push_heap(RandomAccessIterator first, Distance hole_idx, Distance top_idx, T value)
+// Every heap function comes in two flavors: ordered by operator< (max-heap), or by 'comp'
+// (the element for which comp(x, top) is false for every x is at the top).
+
+template<typename RandomAccessIterator, typename Distance, typename T, typename Compare>
+void __push_heap(
+    RandomAccessIterator first, Distance hole_idx, Distance top_idx, T value, Compare comp)
 {
     // Idea: percolate up the heap, and update hole_idx on the way
     Distance parent = (hole_idx - 1) / 2;
-    while (hole_idx > top_idx && *(first + parent) < value) {
+    while (hole_idx > top_idx && comp(*(first + parent), value)) {
         // not yet reach root node, and parent's value is smaller: move upwards
-        *(first + hole_idx) = *(first + parent);  // swap with parent value
+        *(first + hole_idx) = std::move(*(first + parent));  // swap with parent value
         hole_idx = parent;
         parent = (hole_idx - 1) / 2;  // jump to next parent node
     }
-    *(first + hole_idx) = value;  // final hold_idx is found, put new value here
+    *(first + hole_idx) = std::move(value);  // final hold_idx is found, put new value here
 }
 
 /**
@@ -29,9 +39,11 @@ void __push_heap(RandomAccessIterator first, Distance hole_idx, Distance top_idx
  * @param hole_idx Index of current node that is to be adjusted
  * @param len Range of current sub-heap (i.e., last - first)
  * @param value Value of current node that is to be adjusted
+ * @param comp Ordering of the heap
  */
-template<typename RandomAccessIterator, typename Distance, typename T>
-inline void __adjust_heap(RandomAccessIterator first, Distance hole_idx, Distance len, T value)
+template<typename RandomAccessIterator, typename Distance, typename T, typename Compare>
+inline void __adjust_heap(
+    RandomAccessIterator first, Distance hole_idx, Distance len, T value, Compare comp)
 {
     // hole_idx: element that will travel downwards to update the heap requirements
     Distance top_idx = hole_idx;
@@ -39,71 +51,93 @@ inline void __adjust_heap(RandomAccessIterator first, Distance hole_idx, Distanc
     Distance candidate_child = 2 * hole_idx + 2;
     while (candidate_child < len) {
         // compare two childs
-        if (*(first + (candidate_child - 1)) > *(first + candidate_child)) {
+        if (comp(*(first + candidate_child), *(first + (candidate_child - 1)))) {
             candidate_child--;  // update candidate to left child
         }
-        *(first + hole_idx) = *(first + candidate_child);
+        *(first + hole_idx) = std::move(*(first + candidate_child));
         hole_idx = candidate_child;
         candidate_child = 2 * (candidate_child + 1);
     }
     if (candidate_child == len) {
         // no right child, only left child
-        *(first + hole_idx) = *(first + (candidate_child - 1));
+        *(first + hole_idx) = std::move(*(first + (candidate_child - 1)));
         hole_idx = candidate_child - 1;
     }
     // value is inserted at bottom, however, the value is not checked
     // with child's value during percolating downwards, so heap structure may
     // not be correct, we need to call push_heap to keep structure correct.
-    __push_heap(first, hole_idx, top_idx, value);
+    mini::algo::__push_heap(first, hole_idx, top_idx, std::move(value), comp);
+}
+
+template<typename RandomAccessIterator, typename Distance, typename T, typename Compare>
+inline void __push_heap_aux(
+    RandomAccessIterator first, RandomAccessIterator last, Distance*, T*, Compare comp)
+{
+    mini::algo::__push_heap(
+        first, Distance(last - first - 1), Distance(0), T(std::move(*(last - 1))), comp);
 }
 
-template<typename RandomAccessIterator, typename Distance, typename T>
-inline void __push_heap_aux(RandomAccessIterator first, RandomAccessIterator last, Distance*, T*)
+template<typename RandomAccessIterator, typename Compare>
+inline void push_heap(RandomAccessIterator first, RandomAccessIterator last, Compare comp)
 {
-    mini::algo::__push_heap(first, Distance(last - first - 1), Distance(0), T(*(last - 1)));
+    // element to be pushed into heap is already put at the tail of the underlying container
+    mini::algo::__push_heap_aux(
+        first, last, iter::distance_type(first), iter::value_type(first), comp);
 }
 
 template<typename RandomAccessIterator>
 inline void push_heap(RandomAccessIterator first, RandomAccessIterator last)
 {
-    // element to be pushed into heap is already put at the tail of the underlying container
-    mini::algo::__push_heap_aux(first, last, iter::distance_type(first), iter::value_type(first));
+    mini::algo::push_heap(first, last, func::less<>());
 }
 
-template<typename RandomAccessIterator, typename Distance, typename T>
+template<typename RandomAccessIterator, typename Distance, typename T, typename Compare>
 inline void __pop_heap(RandomAccessIterator first, RandomAccessIterator last,
-    RandomAccessIterator result, T value, Distance*)
+    RandomAccessIterator result, T value, Distance*, Compare comp)
 {
-    *result = *first;  // copy the max value to last position: meaning that it's popped
-    mini::algo::__adjust_heap(first, Distance(0), Distance(last - first), value);
+    *result = std::move(*first);  // move the max value to last position: meaning that it's popped
+    mini::algo::__adjust_heap(first, Distance(0), Distance(last - first), std::move(value), comp);
 }
 
-template<typename RandomAccessIterator, typename T>
-inline void __pop_heap_aux(RandomAccessIterator first, RandomAccessIterator last, T*)
+template<typename RandomAccessIterator, typename T, typename Compare>
+inline void __pop_heap_aux(RandomAccessIterator first, RandomAccessIterator last, T*, Compare comp)
 {
-    mini::algo::__pop_heap(first, last - 1, last - 1, T(*(last - 1)), iter::distance_type(first));
+    mini::algo::__pop_heap(
+        first, last - 1, last - 1, T(std::move(*(last - 1))), iter::distance_type(first), comp);
+}
+
+template<typename RandomAccessIterator, typename Compare>
+inline void pop_heap(RandomAccessIterator first, RandomAccessIterator last, Compare comp)
+{
+    mini::algo::__pop_heap_aux(first, last, iter::value_type(first), comp);
 }
 
 template<typename RandomAccessIterator>
 inline void pop_heap(RandomAccessIterator first, RandomAccessIterator last)
 {
-    mini::algo::__pop_heap_aux(first, last, iter::value_type(first));
+    mini::algo::pop_heap(first, last, func::less<>());
 }
 
 // Sort elements in a heap in increasing order.
 // Sorted elements is not a heap anymore.
-template<typename RandomAccessIterator>
-void sort_heap(RandomAccessIterator first, RandomAccessIterator last)
+template<typename RandomAccessIterator, typename Compare>
+void sort_heap(RandomAccessIterator first, RandomAccessIterator last, Compare comp)
 {
     // Every call to pop_heap will put the current max value to the end of current range
     // Sorted in increasing order
     while (last - first > 1) {
-        mini::algo::pop_heap(first, last--);
+        mini::algo::pop_heap(first, last--, comp);
     }
 }
 
-template<typename RandomAccessIterator, typename T, typename Distance>
-void __make_heap(RandomAccessIterator first, RandomAccessIterator last, T*, Distance*)
+template<typename RandomAccessIterator>
+void sort_heap(RandomAccessIterator first, RandomAccessIterator last)
+{
+    mini::algo::sort_heap(first, last, func::less<>());
+}
+
+template<typename RandomAccessIterator, typename T, typename Distance, typename Compare>
+void __make_heap(RandomAccessIterator first, RandomAccessIterator last, T*, Distance*, Compare comp)
 {
     Distance len = last - first;
     if (len <= 1) {  // empty of only one element
@@ -114,15 +148,211 @@ void __make_heap(RandomAccessIterator first, RandomAccessIterator last, T*, Dist
     do {
         // adjust each sub-heap starting from last node of second-last layer
         // way up to root, following by decrementing idx by one.
-        mini::algo::__adjust_heap(first, hole_idx, len, T(*(first + hole_idx)));
+        mini::algo::__adjust_heap(first, hole_idx, len, T(std::move(*(first + hole_idx))), comp);
     } while (hole_idx--);  // stop after finishing adjusting root node
 }
 
 // Make a heap from elements of range [first, last) from underlying container.
+template<typename RandomAccessIterator, typename Compare>
+inline void make_heap(RandomAccessIterator first, RandomAccessIterator last, Compare comp)
+{
+    mini::algo::__make_heap(
+        first, last, iter::value_type(first), iter::distance_type(first), comp);
+}
+
 template<typename RandomAccessIterator>
 inline void make_heap(RandomAccessIterator first, RandomAccessIterator last)
 {
-    mini::algo::__make_heap(first, last, iter::value_type(first), iter::distance_type(first));
+    mini::algo::make_heap(first, last, func::less<>());
+}
+
+//// d-ary heap ////
+
+// Heaps with 'Arity' children per node: the children of node i are the contiguous group
+// Arity * i + 1 to Arity * i + Arity. Wider nodes make the heap shallower: log_Arity(n) levels,
+// whose child group is scanned in one go (16 bytes for 4 ints, or 32 for 4 pointers: within one
+// or two cache lines), instead of log2(n) levels with a likely cache miss each.
+
+template<size_t Arity, typename RandomAccessIterator, typename Distance, typename T,
+    typename Compare>
+void __push_dary_heap(
+    RandomAccessIterator first, Distance hole_idx, Distance top_idx, T value, Compare& comp)
+{
+    while (hole_idx > top_idx) {
+        const Distance parent = (hole_idx - 1) / Distance(Arity);
+        if (!comp(*(first + parent), value)) {
+            break;
+        }
+        *(first + hole_idx) = std::move(*(first + parent));
+        hole_idx = parent;
+    }
+    *(first + hole_idx) = std::move(value);
+}
+
+// Index of the largest of the 'Count' elements from index 'base', the first of equal ones. A
+// tournament unrolled at compile time: the matches of a round do not depend on each other, and
+// the winner is selected without a branch, which would be mispredicted half of the time.
+template<size_t Count, typename RandomAccessIterator, typename Distance, typename Compare>
+inline Distance __max_child(RandomAccessIterator first, Distance base, Compare& comp)
+{
+    if constexpr (Count == 1) {
+        return base;
+    } else {
+        const Distance a = mini::algo::__max_child<Count / 2>(first, base, comp);
+        const Distance b =
+            mini::algo::__max_child<Count - Count / 2>(first, base + Distance(Count / 2), comp);
+        return a + Distance(comp(*(first + a), *(first + b))) * (b - a);
+    }
+}
+
+/**
+ * @brief Floyd's bottom-up sift: move the hole at 'hole_idx' down to a leaf along the largest
+ *        children, then put 'value' at the leaf and sift it up.
+ *
+ * @attention Going down costs Arity - 1 comparisons per level to find the largest child, and
+ *            none against 'value': it comes from the bottom of the heap (after a pop), so it
+ *            belongs near the bottom, and sifting it up from the leaf usually takes one or two
+ *            comparisons instead of one per level.
+ */
+template<size_t Arity, typename RandomAccessIterator, typename Distance, typename T,
+    typename Compare>
+void __adjust_dary_heap(
+    RandomAccessIterator first, Distance hole_idx, Distance len, T value, Compare& comp)
+{
+    const Distance top_idx = hole_idx;
+    for (;;) {
+        const Distance child = Distance(Arity) * hole_idx + 1;
+        if (child >= len) {
+            break;
+        }
+        if constexpr (std::is_convertible_v<
+                          typename iter::iterator_traits<RandomAccessIterator>::iterator_category,
+                          iter::contiguous_iterator_tag>) {
+            // the grandchildren are one contiguous block: fetch it while the children compete
+            const Distance grandchild = Distance(Arity) * child + 1;
+            if (grandchild < len) {
+                const Distance end = len - grandchild < Distance(Arity * Arity)
+                                         ? len
+                                         : grandchild + Distance(Arity * Arity);
+                const char* p =
+                    reinterpret_cast<const char*>(iter::__to_address(first + grandchild));
+                const char* last =
+                    reinterpret_cast<const char*>(iter::__to_address(first + (end - 1)));
+                for (; p < last; p += mem::cache_line_size) {
+                    __builtin_prefetch(p);
+                }
+                __builtin_prefetch(last);
+            }
+        }
+        Distance best = child;
+        if (len - child >= Distance(Arity)) {
+            best = mini::algo::__max_child<Arity>(first, child, comp);
+        } else {
+            for (Distance c = child + 1; c < len; ++c) {
+                if (comp(*(first + best), *(first + c))) {
+                    best = c;
+                }
+            }
+        }
+        *(first + hole_idx) = std::move(*(first + best));
+        hole_idx = best;
+    }
+    mini::algo::__push_dary_heap<Arity>(first, hole_idx, top_idx, std::move(value), comp);
+}
+
+/**
+ * @brief Push *(last - 1) into the Arity-ary heap [first, last - 1).
+ *
+ * @attention log_Arity(n) comparisons at most.
+ */
+template<size_t Arity = 4, typename RandomAccessIterator, typename Compare>
+void push_dary_heap(RandomAccessIterator first, RandomAccessIterator last, Compare comp)
+{
+    static_assert(Arity >= 2, "a heap node has at least two children");
+    typedef typename iter::iterator_traits<RandomAccessIterator>::difference_type Distance;
+    typedef typename iter::iterator_traits<RandomAccessIterator>::value_type T;
+
+    mini::algo::__push_dary_heap<Arity>(
+        first, Distance(last - first - 1), Distance(0), T(std::move(*(last - 1))), comp);
+}
+
+template<size_t Arity = 4, typename RandomAccessIterator>
+void push_dary_heap(RandomAccessIterator first, RandomAccessIterator last)
+{
+    mini::algo::push_dary_heap<Arity>(first, last, func::less<>());
+}
+
+/**
+ * @brief Move the top of the Arity-ary heap [first, last) to last - 1, [first, last - 1) stays
+ *        a heap.
+ *
+ * @attention Bottom-up: about (Arity - 1) * log_Arity(n) comparisons.
+ */
+template<size_t Arity = 4, typename RandomAccessIterator, typename Compare>
+void pop_dary_heap(RandomAccessIterator first, RandomAccessIterator last, Compare comp)
+{
+    static_assert(Arity >= 2, "a heap node has at least two children");
+    typedef typename iter::iterator_traits<RandomAccessIterator>::difference_type Distance;
+    typedef typename iter::iterator_traits<RandomAccessIterator>::value_type T;
+
+    if (last - first < 2) {
+        return;
+    }
+    --last;
+    T value = std::move(*last);
+    *last = std::move(*first);
+    mini::algo::__adjust_dary_heap<Arity>(
+        first, Distance(0), Distance(last - first), std::move(value), comp);
+}
+
+template<size_t Arity = 4, typename RandomAccessIterator>
+void pop_dary_heap(RandomAccessIterator first, RandomAccessIterator last)
+{
+    mini::algo::pop_dary_heap<Arity>(first, last, func::less<>());
+}
+
+/**
+ * @brief Make an Arity-ary heap from [first, last), bottom-up: O(n).
+ */
+template<size_t Arity = 4, typename RandomAccessIterator, typename Compare>
+void make_dary_heap(RandomAccessIterator first, RandomAccessIterator last, Compare comp)
+{
+    static_assert(Arity >= 2, "a heap node has at least two children");
+    typedef typename iter::iterator_traits<RandomAccessIterator>::difference_type Distance;
+    typedef typename iter::iterator_traits<RandomAccessIterator>::value_type T;
+
+    const Distance len = last - first;
+    if (len < 2) {
+        return;
+    }
+    // from the last node with children up to the root
+    for (Distance hole_idx = (len - 2) / Distance(Arity) + 1; hole_idx-- > 0;) {
+        mini::algo::__adjust_dary_heap<Arity>(
+            first, hole_idx, len, T(std::move(*(first + hole_idx))), comp);
+    }
+}
+
+template<size_t Arity = 4, typename RandomAccessIterator>
+void make_dary_heap(RandomAccessIterator first, RandomAccessIterator last)
+{
+    mini::algo::make_dary_heap<Arity>(first, last, func::less<>());
+}
+
+/**
+ * @brief Sort the Arity-ary heap [first, last) in increasing order of 'comp'.
+ */
+template<size_t Arity = 4, typename RandomAccessIterator, typename Compare>
+void sort_dary_heap(RandomAccessIterator first, RandomAccessIterator last, Compare comp)
+{
+    while (last - first > 1) {
+        mini::algo::pop_dary_heap<Arity>(first, last--, comp);
+    }
+}
+
+template<size_t Arity = 4, typename RandomAccessIterator>
+void sort_dary_heap(RandomAccessIterator first, RandomAccessIterator last)
+{
+    mini::algo::sort_dary_heap<Arity>(first, last, func::less<>());
 }
 
 }  // namespace mini::algo
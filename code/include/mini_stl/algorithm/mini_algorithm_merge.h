@@ -0,0 +1,437 @@
+#ifndef MINI_ALGORITHM_MERGE_H
+#define MINI_ALGORITHM_MERGE_H
+
+#include "mini_stl/algorithm/mini_algorithm_base.h"
+#include "mini_stl/base/mini_base_macro.h"
+#include "mini_stl/functional/mini_functional_relational.h"
+#include "mini_stl/iterator/mini_iterator_base.h"
+#include "mini_stl/memory/mini_memory_alloc.h"
+#include "mini_stl/memory/mini_memory_construct.h"
+#include "mini_stl/utility/mini_utility_base.h"
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+namespace mini::algo {
+
+//// two-way merge ////
+
+template<typename InputIterator1, typename InputIterator2, typename OutputIterator,
+    typename Compare>
+OutputIterator __merge(InputIterator1 first1, InputIterator1 last1, InputIterator2 first2,
+    InputIterator2 last2, OutputIterator result, Compare& comp)
+{
+    while (first1 != last1 && first2 != last2) {
+        if (comp(*first2, *first1)) {
+            *result = *first2;
+            ++first2;
+        } else {
+            *result = *first1;
+            ++first1;
+        }
+        ++result;
+    }
+    return mini::algo::copy(first2, last2, mini::algo::copy(first1, last1, result));
+}
+
+/**
+ * @brief Merge the sorted ranges [first1, last1) and [first2, last2) into 'result'. Stable:
+ *        of equal elements, the ones of the first range come first.
+ *
+ * @return Output iterator past the last element written
+ */
+template<typename InputIterator1, typename InputIterator2, typename OutputIterator,
+    typename Compare>
+OutputIterator merge(InputIterator1 first1, InputIterator1 last1, InputIterator2 first2,
+    InputIterator2 last2, OutputIterator result, Compare comp)
+{
+    return mini::algo::__merge(first1, last1, first2, last2, result, comp);
+}
+
+template<typename InputIterator1, typename InputIterator2, typename OutputIterator>
+OutputIterator merge(InputIterator1 first1, InputIterator1 last1, InputIterator2 first2,
+    InputIterator2 last2, OutputIterator result)
+{
+    return mini::algo::merge(first1, last1, first2, last2, result, func::less<>());
+}
+
+//// galloping merge ////
+
+// A side that wins this many times in a row switches the merge to galloping
+inline constexpr ptrdiff_t __gallop_threshold = 7;
+
+// Length of the prefix of [first, first + len) on which 'pred' holds, 'pred' being true on a
+// prefix only: probe 1, 2, 4, ... elements ahead, then binary search the last interval.
+// O(log k) comparisons for a prefix of length k, however long the range.
+template<typename RandomAccessIterator, typename Predicate>
+ptrdiff_t __gallop(RandomAccessIterator first, ptrdiff_t len, Predicate pred)
+{
+    ptrdiff_t lo = 0;  // pred holds on [0, lo)
+    ptrdiff_t bound = 1;
+    while (bound <= len && pred(*(first + (bound - 1)))) {
+        lo = bound;
+        bound *= 2;
+    }
+    ptrdiff_t hi = bound <= len ? bound - 1 : len;  // pred fails at hi, unless hi == len
+    while (lo < hi) {
+        const ptrdiff_t mid = lo + (hi - lo) / 2;
+        if (pred(*(first + mid))) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    return lo;
+}
+
+template<typename InputIterator1, typename InputIterator2, typename OutputIterator,
+    typename Compare>
+OutputIterator __gallop_merge(InputIterator1 first1, InputIterator1 last1, InputIterator2 first2,
+    InputIterator2 last2, OutputIterator result, Compare& comp, iter::input_iterator_tag,
+    iter::input_iterator_tag)
+{
+    return mini::algo::__merge(first1, last1, first2, last2, result, comp);
+}
+
+template<typename RandomAccessIterator1, typename RandomAccessIterator2,
+    typename OutputIterator, typename Compare>
+OutputIterator __gallop_merge(RandomAccessIterator1 first1, RandomAccessIterator1 last1,
+    RandomAccessIterator2 first2, RandomAccessIterator2 last2, OutputIterator result,
+    Compare& comp, iter::random_access_iterator_tag, iter::random_access_iterator_tag)
+{
+    while (first1 != last1 && first2 != last2) {
+        // one element at a time, until a side wins often in a row
+        ptrdiff_t wins1 = 0;
+        ptrdiff_t wins2 = 0;
+        do {
+            if (comp(*first2, *first1)) {
+                *result = *first2;
+                ++first2;
+                ++wins2;
+                wins1 = 0;
+            } else {
+                *result = *first1;
+                ++first1;
+                ++wins1;
+                wins2 = 0;
+            }
+            ++result;
+        } while (first1 != last1 && first2 != last2 && wins1 < __gallop_threshold
+            && wins2 < __gallop_threshold);
+
+        // whole blocks at a time, while the blocks stay long
+        while (first1 != last1 && first2 != last2) {
+            const ptrdiff_t n1 = mini::algo::__gallop(first1, last1 - first1,
+                [&](const auto& x) { return !comp(*first2, x); });
+            result = mini::algo::copy(first1, first1 + n1, result);
+            first1 += n1;
+            if (first1 == last1) {
+                break;
+            }
+            const ptrdiff_t n2 = mini::algo::__gallop(first2, last2 - first2,
+                [&](const auto& x) { return comp(x, *first1); });
+            result = mini::algo::copy(first2, first2 + n2, result);
+            first2 += n2;
+            if (n1 < __gallop_threshold && n2 < __gallop_threshold) {
+                break;  // interleaved again: galloping would cost more comparisons
+            }
+        }
+    }
+    return mini::algo::copy(first2, last2, mini::algo::copy(first1, last1, result));
+}
+
+/**
+ * @brief Merge the sorted ranges [first1, last1) and [first2, last2) into 'result', galloping
+ *        over long stretches of one range. Stable, like merge().
+ *
+ * @attention Merges one element at a time until one range wins 7 times in a row, then looks
+ *            up where the head of each range falls in the other one by exponential search and
+ *            copies the whole block before it. A block of k elements costs O(log k)
+ *            comparisons, so skewed inputs (one range much shorter, or ranges that overlap
+ *            little) merge in far fewer comparisons than the n of merge(). Back to one at a
+ *            time when the blocks get short.
+ * @attention Gallops on random access iterators only, otherwise same as merge().
+ */
+template<typename InputIterator1, typename InputIterator2, typename OutputIterator,
+    typename Compare>
+OutputIterator gallop_merge(InputIterator1 first1, InputIterator1 last1, InputIterator2 first2,
+    InputIterator2 last2, OutputIterator result, Compare comp)
+{
+    return mini::algo::__gallop_merge(first1, last1, first2, last2, result, comp,
+        iter::iterator_category(first1), iter::iterator_category(first2));
+}
+
+template<typename InputIterator1, typename InputIterator2, typename OutputIterator>
+OutputIterator gallop_merge(InputIterator1 first1, InputIterator1 last1, InputIterator2 first2,
+    InputIterator2 last2, OutputIterator result)
+{
+    return mini::algo::gallop_merge(first1, last1, first2, last2, result, func::less<>());
+}
+
+//// k-way merge ////
+
+// Bounds of a run given as a pair of iterators
+template<typename InputIterator>
+inline InputIterator __run_begin(const util::pair<InputIterator, InputIterator>& run)
+{
+    return run.first;
+}
+
+template<typename InputIterator>
+inline InputIterator __run_end(const util::pair<InputIterator, InputIterator>& run)
+{
+    return run.second;
+}
+
+// Bounds of a run given as a container
+template<typename Container>
+inline auto __run_begin(Container& run) -> decltype(run.begin())
+{
+    return run.begin();
+}
+
+template<typename Container>
+inline auto __run_end(Container& run) -> decltype(run.end())
+{
+    return run.end();
+}
+
+/**
+ * @brief Streaming merge of k sorted runs through a tournament tree of losers: top() is the
+ *        smallest head of all runs, pop() moves past it.
+ *
+ * @attention Each internal node keeps the run that lost the match played there, the overall
+ *            winner is kept apart. pop() only replays the matches on the path from the
+ *            winner's leaf to the root, against the stored losers: exactly ceil(log2 k)
+ *            comparisons per element, without the sibling comparisons of a binary heap
+ *            (about 2 log2 k per element with push_heap/pop_heap).
+ * @attention Stable: of equal elements, the ones of the run given first come first. An
+ *            exhausted run loses every match.
+ * @attention Reads each run once, front to back, through iterators whose operator* returns a
+ *            reference. The runs must stay alive and unchanged while the tree is in use.
+ * @tparam InputIterator iterator type of the runs
+ * @tparam Compare strict weak ordering the runs are sorted by
+ */
+template<typename InputIterator, typename Compare = func::less<>>
+class loser_tree {
+    MINI_DISALLOW_COPY_AND_MOVE(loser_tree);
+
+public:  // public typedefs
+    typedef typename iter::iterator_traits<InputIterator>::value_type value_type;
+    typedef typename iter::iterator_traits<InputIterator>::reference reference;
+    typedef size_t size_type;
+
+protected:  // internal typedefs
+    // unread part of a run
+    struct cursor {
+        InputIterator first;
+        InputIterator last;
+    };
+
+    typedef mem::simple_alloc<cursor, mem::alloc> cursor_allocator;
+    typedef mem::simple_alloc<size_type, mem::alloc> node_allocator;
+
+public:
+    /**
+     * @brief Merge the runs of [runs_first, runs_last): containers, or util::pair of iterators.
+     */
+    template<typename RunIterator>
+    loser_tree(RunIterator runs_first, RunIterator runs_last, Compare comp = Compare())
+        : runs_(0)
+        , tree_(0)
+        , k_(0)
+        , live_(0)
+        , comp_(comp)
+    {
+        for (RunIterator it = runs_first; it != runs_last; ++it) {
+            ++k_;
+        }
+        if (k_ == 0) {
+            return;
+        }
+        runs_ = cursor_allocator::allocate(k_);
+        size_type count = 0;
+        try {
+            for (; runs_first != runs_last; ++runs_first, ++count) {
+                mem::construct(runs_ + count,
+                    cursor{mini::algo::__run_begin(*runs_first),
+                        mini::algo::__run_end(*runs_first)});
+                live_ += runs_[count].first != runs_[count].last;
+            }
+            tree_ = node_allocator::allocate(k_);
+            tree_[0] = build(1);
+        } catch (...) {
+            mem::destroy(runs_, runs_ + count);
+            cursor_allocator::deallocate(runs_, k_);
+            if (tree_) {
+                node_allocator::deallocate(tree_, k_);
+            }
+            throw;
+        }
+    }
+
+    ~loser_tree()
+    {
+        if (runs_) {
+            mem::destroy(runs_, runs_ + k_);
+            cursor_allocator::deallocate(runs_, k_);
+            node_allocator::deallocate(tree_, k_);
+        }
+    }
+
+public:
+    // Whether every run is exhausted
+    bool empty() const { return live_ == 0; }
+
+    // Number of runs not exhausted yet
+    size_type live_runs() const { return live_; }
+
+    /**
+     * @brief Smallest head of the runs. Not empty() only.
+     */
+    reference top() const { return *runs_[tree_[0]].first; }
+
+    /**
+     * @brief Index of the run top() comes from, in the order the runs were given
+     */
+    size_type top_run() const { return tree_[0]; }
+
+    /**
+     * @brief Move past top() and find the next smallest head. Not empty() only.
+     */
+    void pop()
+    {
+        size_type winner = tree_[0];
+        cursor& run = runs_[winner];
+        ++run.first;
+        if (run.first == run.last) {
+            --live_;
+        }
+        // while every run has elements left, no head needs a bound check
+        tree_[0] = live_ == k_ ? replay_unguarded(winner) : replay(winner);
+    }
+
+    /**
+     * @brief Write every remaining element to 'result', in order.
+     *
+     * @attention Once a single run is left, the rest of it is copied without comparisons.
+     * @return Output iterator past the last element written
+     */
+    template<typename OutputIterator>
+    OutputIterator drain(OutputIterator result)
+    {
+        while (live_ > 1) {
+            *result = top();
+            ++result;
+            pop();
+        }
+        if (live_ == 1) {
+            cursor& run = runs_[tree_[0]];
+            result = mini::algo::copy(run.first, run.last, result);
+            run.first = run.last;
+            live_ = 0;
+        }
+        return result;
+    }
+
+protected:  // internal methods
+    bool exhausted(size_type run) const { return runs_[run].first == runs_[run].last; }
+
+    // Whether run 'a' wins its match against run 'b': it has the smaller head, or equal heads
+    // and was given first. One comparison.
+    bool beats(size_type a, size_type b) const
+    {
+        if (exhausted(b)) {
+            return !exhausted(a) || a < b;
+        }
+        if (exhausted(a)) {
+            return false;
+        }
+        return a < b ? !comp_(*runs_[b].first, *runs_[a].first)
+                     : comp_(*runs_[a].first, *runs_[b].first);
+    }
+
+    // Replay the matches on the path from the leaf of run 'winner' to the root against the
+    // stored losers, return the overall winner
+    size_type replay(size_type winner)
+    {
+        for (size_type node = (k_ + winner) / 2; node != 0; node /= 2) {
+            if (beats(tree_[node], winner)) {
+                std::swap(tree_[node], winner);
+            }
+        }
+        return winner;
+    }
+
+    // Same as replay(), while every run has elements left: no bound checks. The head of the
+    // winner is kept at hand, so that the next match only waits for one comparison, and the
+    // winner is selected without a branch: both outcomes are equally likely.
+    size_type replay_unguarded(size_type winner)
+    {
+        const value_type* head = &*runs_[winner].first;
+        for (size_type node = (k_ + winner) / 2; node != 0; node /= 2) {
+            const size_type loser = tree_[node];
+            const value_type* loser_head = &*runs_[loser].first;
+            // the run given first wins ties: swap the operands instead of branching on it
+            const bool first = loser < winner;
+            const bool swap =
+                bool(comp_(*(first ? head : loser_head), *(first ? loser_head : head))) != first;
+            tree_[node] = swap ? winner : loser;
+            winner = swap ? loser : winner;
+            head = swap ? loser_head : head;
+        }
+        return winner;
+    }
+
+    // Play the matches of the subtree of 'node' and return its winner. Leaf of run i is node
+    // k + i, the children of node n are 2n and 2n + 1: with k leaves, nodes 1 to k - 1 all have
+    // two children.
+    size_type build(size_type node)
+    {
+        if (node >= k_) {
+            return node - k_;
+        }
+        const size_type left = build(2 * node);
+        const size_type right = build(2 * node + 1);
+        const bool left_wins = beats(left, right);
+        tree_[node] = left_wins ? right : left;
+        return left_wins ? left : right;
+    }
+
+protected:
+    cursor* runs_;     // k_ runs, in the order given
+    size_type* tree_;  // tree_[0]: winner run, tree_[1..k_ - 1]: loser run of each match
+    size_type k_;      // number of runs
+    size_type live_;   // number of runs not exhausted
+    Compare comp_;     // order of the runs
+};
+
+/**
+ * @brief Merge the sorted runs of [runs_first, runs_last) into 'result'. Stable: of equal
+ *        elements, the ones of the run given first come first.
+ *
+ * @attention A loser tree picks each element in ceil(log2 k) comparisons, k being the number
+ *            of runs; see loser_tree for a pull interface.
+ * @param runs_first, runs_last Range of runs: containers (vector, deque...) or util::pair of
+ *        iterators
+ * @return Output iterator past the last element written
+ */
+template<typename RunIterator, typename OutputIterator, typename Compare>
+OutputIterator merge(RunIterator runs_first, RunIterator runs_last, OutputIterator result,
+    Compare comp)
+{
+    typedef std::decay_t<decltype(mini::algo::__run_begin(*runs_first))> InputIterator;
+    loser_tree<InputIterator, Compare> tree(runs_first, runs_last, comp);
+    return tree.drain(result);
+}
+
+template<typename RunIterator, typename OutputIterator>
+OutputIterator merge(RunIterator runs_first, RunIterator runs_last, OutputIterator result)
+{
+    return mini::algo::merge(runs_first, runs_last, result, func::less<>());
+}
+
+}  // namespace mini::algo
+
+#endif
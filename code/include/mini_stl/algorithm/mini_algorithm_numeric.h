@@ -0,0 +1,140 @@
+#ifndef MINI_ALGORITHM_NUMERIC_H
+#define MINI_ALGORITHM_NUMERIC_H
+
+#include "mini_stl/iterator/mini_iterator_base.h"
+#include "mini_stl/iterator/mini_iterator_deque.h"
+
+namespace mini::algo {
+
+template<typename T, typename Ref, typename Ptr, size_t BufSiz, typename BufPolicy,
+    typename U>
+U accumulate(iter::__deque_iterator<T, Ref, Ptr, BufSiz, BufPolicy> first,
+    iter::__deque_iterator<T, Ref, Ptr, BufSiz, BufPolicy> last, U init);
+
+template<typename T, typename Ref, typename Ptr, size_t BufSiz, typename BufPolicy, typename U,
+    typename BinaryOperation>
+U accumulate(iter::__deque_iterator<T, Ref, Ptr, BufSiz, BufPolicy> first,
+    iter::__deque_iterator<T, Ref, Ptr, BufSiz, BufPolicy> last, U init, BinaryOperation op);
+
+/**
+ * @brief Fold a range from left to right: init + *first + *(first + 1) + ...
+ *
+ * @param init Initial value, also determines the type of the sum
+ */
+template<typename InputIterator, typename T>
+T accumulate(InputIterator first, InputIterator last, T init)
+{
+    for (; first != last; ++first) {
+        init = init + *first;
+    }
+    return init;
+}
+
+template<typename InputIterator, typename T, typename BinaryOperation>
+T accumulate(InputIterator first, InputIterator last, T init, BinaryOperation op)
+{
+    for (; first != last; ++first) {
+        init = op(init, *first);
+    }
+    return init;
+}
+
+/**
+ * @brief Fold a range with 'op' in unspecified order.
+ *
+ * @attention 'op' is assumed associative and commutative, so that the parallel overloads
+ *            (mini_algorithm_parallel.h) may regroup the elements. Sequentially it is
+ *            accumulate().
+ */
+template<typename InputIterator, typename T, typename BinaryOperation>
+T reduce(InputIterator first, InputIterator last, T init, BinaryOperation op)
+{
+    return mini::algo::accumulate(first, last, init, op);
+}
+
+template<typename InputIterator, typename T>
+T reduce(InputIterator first, InputIterator last, T init)
+{
+    return mini::algo::accumulate(first, last, init);
+}
+
+template<typename InputIterator>
+typename iter::iterator_traits<InputIterator>::value_type reduce(
+    InputIterator first, InputIterator last)
+{
+    typedef typename iter::iterator_traits<InputIterator>::value_type value_type;
+    return mini::algo::accumulate(first, last, value_type());
+}
+
+/**
+ * @brief reduce() over transform_op(*it), without materializing the transformed range.
+ */
+template<typename InputIterator, typename T, typename BinaryOperation, typename UnaryOperation>
+T transform_reduce(InputIterator first, InputIterator last, T init, BinaryOperation reduce_op,
+    UnaryOperation transform_op)
+{
+    for (; first != last; ++first) {
+        init = reduce_op(init, transform_op(*first));
+    }
+    return init;
+}
+
+/**
+ * @brief reduce() over transform_op(*it1, *it2) of two ranges, an inner product by default.
+ */
+template<typename InputIterator1, typename InputIterator2, typename T, typename BinaryOperation1,
+    typename BinaryOperation2>
+T transform_reduce(InputIterator1 first1, InputIterator1 last1, InputIterator2 first2, T init,
+    BinaryOperation1 reduce_op, BinaryOperation2 transform_op)
+{
+    for (; first1 != last1; ++first1, ++first2) {
+        init = reduce_op(init, transform_op(*first1, *first2));
+    }
+    return init;
+}
+
+template<typename InputIterator1, typename InputIterator2, typename T>
+T transform_reduce(InputIterator1 first1, InputIterator1 last1, InputIterator2 first2, T init)
+{
+    for (; first1 != last1; ++first1, ++first2) {
+        init = init + *first1 * *first2;
+    }
+    return init;
+}
+
+// Fold a deque range buffer by buffer
+template<typename T, typename Ref, typename Ptr, size_t BufSiz, typename BufPolicy,
+    typename U>
+U accumulate(iter::__deque_iterator<T, Ref, Ptr, BufSiz, BufPolicy> first,
+    iter::__deque_iterator<T, Ref, Ptr, BufSiz, BufPolicy> last, U init)
+{
+    typedef iter::__deque_iterator<T, Ref, Ptr, BufSiz, BufPolicy> deque_iterator;
+    if (first.node == last.node) {
+        return accumulate(first.cur, last.cur, init);
+    }
+    init = accumulate(first.cur, first.last, init);
+    for (typename deque_iterator::map_pointer node = first.node + 1; node != last.node; ++node) {
+        init = accumulate(*node, *node + deque_iterator::buffer_size(), init);
+    }
+    return accumulate(last.first, last.cur, init);
+}
+
+template<typename T, typename Ref, typename Ptr, size_t BufSiz, typename BufPolicy, typename U,
+    typename BinaryOperation>
+U accumulate(iter::__deque_iterator<T, Ref, Ptr, BufSiz, BufPolicy> first,
+    iter::__deque_iterator<T, Ref, Ptr, BufSiz, BufPolicy> last, U init, BinaryOperation op)
+{
+    typedef iter::__deque_iterator<T, Ref, Ptr, BufSiz, BufPolicy> deque_iterator;
+    if (first.node == last.node) {
+        return accumulate(first.cur, last.cur, init, op);
+    }
+    init = accumulate(first.cur, first.last, init, op);
+    for (typename deque_iterator::map_pointer node = first.node + 1; node != last.node; ++node) {
+        init = accumulate(*node, *node + deque_iterator::buffer_size(), init, op);
+    }
+    return accumulate(last.first, last.cur, init, op);
+}
+
+}  // namespace mini::algo
+
+#endif
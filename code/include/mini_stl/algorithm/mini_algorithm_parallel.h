@@ -0,0 +1,656 @@
+#ifndef MINI_ALGORITHM_PARALLEL_H
+#define MINI_ALGORITHM_PARALLEL_H
+
+#include "mini_stl/algorithm/mini_algorithm_base.h"
+#include "mini_stl/algorithm/mini_algorithm_numeric.h"
+#include "mini_stl/algorithm/mini_algorithm_radix_sort.h"
+#include "mini_stl/algorithm/mini_algorithm_sort.h"
+#include "mini_stl/container/mini_container_vector.h"
+#include "mini_stl/execution/mini_execution_parallel.h"
+#include "mini_stl/execution/mini_execution_policy.h"
+#include "mini_stl/iterator/mini_iterator_base.h"
+
+#include <type_traits>
+
+// Execution policy overloads: algo::for_each(exec::par, first, last, func) etc.
+//
+// With a parallel policy and random access iterators (vector, deque, pointers), the range is cut
+// into equal pieces, a few per worker so that stealing can even out the load, and each piece is
+// processed by the sequential algorithm. Deque pieces therefore still run buffer by buffer.
+// Small ranges, single-worker pools, other iterator categories and exec::seq run sequentially.
+
+namespace mini::algo {
+
+template<typename Policy, typename Result = void>
+using __enable_if_execution_policy =
+    std::enable_if_t<exec::is_execution_policy_v<std::decay_t<Policy>>, Result>;
+
+template<typename Iterator>
+inline constexpr bool __is_random_access_iterator_v = std::is_base_of_v<
+    iter::random_access_iterator_tag, typename iter::iterator_traits<Iterator>::iterator_category>;
+
+// true if the policy asks for parallelism and every iterator can be split in O(1)
+template<typename Policy, typename... Iterators>
+inline constexpr bool __run_parallel_v =
+    !std::is_same_v<std::decay_t<Policy>, exec::sequenced_policy> &&
+    (__is_random_access_iterator_v<Iterators> && ...);
+
+// Fewer elements than this per piece do not pay for scheduling a task
+inline constexpr size_t __parallel_min_grain = 4096;
+
+// Pieces per worker, for load balancing
+inline constexpr size_t __parallel_pieces_per_worker = 4;
+
+// Number of pieces [0, n) is cut into, 1 to run sequentially
+inline size_t __parallel_piece_count(const exec::thread_pool& pool, size_t n)
+{
+    if (pool.size() < 2) {
+        return 1;
+    }
+    size_t pieces = n / __parallel_min_grain;
+    const size_t max_pieces = pool.size() * __parallel_pieces_per_worker;
+    if (pieces > max_pieces) {
+        pieces = max_pieces;
+    }
+    return pieces != 0 ? pieces : 1;
+}
+
+// Call func(i, piece_first, piece_last) for each of the 'pieces' equal pieces of [0, n), in
+// parallel. 'n' is at least 'pieces', so that no piece is empty.
+template<typename Function>
+void __parallel_pieces(exec::thread_pool& pool, size_t n, size_t pieces, Function&& func)
+{
+    exec::parallel_for(pool, size_t(0), pieces, 1, [n, pieces, &func](size_t lo, size_t hi) {
+        for (size_t i = lo; i < hi; ++i) {
+            func(i, n / pieces * i + n % pieces * i / pieces,
+                n / pieces * (i + 1) + n % pieces * (i + 1) / pieces);
+        }
+    });
+}
+
+// Move construct [first, first + n) into the raw storage 'buffer', piece by piece in parallel.
+// Should a piece throw, the pieces already built are destroyed before the exception goes on.
+template<typename RandomAccessIterator, typename T>
+void __parallel_uninitialized_move(
+    exec::thread_pool& pool, RandomAccessIterator first, size_t n, size_t pieces, T* buffer)
+{
+    ctnr::vector<size_t> built(2 * pieces, 0);  // [lo, hi) of each piece once built
+    try {
+        __parallel_pieces(pool, n, pieces, [first, buffer, &built](size_t i, size_t lo, size_t hi) {
+            mem::uninitialized_move(first + lo, first + hi, buffer + lo);
+            built[2 * i] = lo;
+            built[2 * i + 1] = hi;
+        });
+    } catch (...) {
+        for (size_t i = 0; i < pieces; ++i) {
+            mem::destroy(buffer + built[2 * i], buffer + built[2 * i + 1]);
+        }
+        throw;
+    }
+}
+
+// for_each
+
+template<typename ExecutionPolicy, typename ForwardIterator, typename Function>
+__enable_if_execution_policy<ExecutionPolicy> for_each(
+    ExecutionPolicy&& policy, ForwardIterator first, ForwardIterator last, Function&& func)
+{
+    if constexpr (__run_parallel_v<ExecutionPolicy, ForwardIterator>) {
+        exec::thread_pool& pool = policy.pool();
+        const size_t n = size_t(last - first);
+        const size_t pieces = __parallel_piece_count(pool, n);
+        if (pieces > 1) {
+            __parallel_pieces(pool, n, pieces, [first, &func](size_t, size_t lo, size_t hi) {
+                mini::algo::for_each(first + lo, first + hi, func);
+            });
+            return;
+        }
+    }
+    mini::algo::for_each(first, last, func);
+}
+
+// transform
+
+template<typename ExecutionPolicy, typename ForwardIterator1, typename ForwardIterator2,
+    typename UnaryOperation>
+__enable_if_execution_policy<ExecutionPolicy, ForwardIterator2> transform(ExecutionPolicy&& policy,
+    ForwardIterator1 first, ForwardIterator1 last, ForwardIterator2 result, UnaryOperation op)
+{
+    if constexpr (__run_parallel_v<ExecutionPolicy, ForwardIterator1, ForwardIterator2>) {
+        exec::thread_pool& pool = policy.pool();
+        const size_t n = size_t(last - first);
+        const size_t pieces = __parallel_piece_count(pool, n);
+        if (pieces > 1) {
+            __parallel_pieces(pool, n, pieces, [first, result, &op](size_t, size_t lo, size_t hi) {
+                mini::algo::transform(first + lo, first + hi, result + lo, op);
+            });
+            return result + n;
+        }
+    }
+    return mini::algo::transform(first, last, result, op);
+}
+
+template<typename ExecutionPolicy, typename ForwardIterator1, typename ForwardIterator2,
+    typename ForwardIterator3, typename BinaryOperation>
+__enable_if_execution_policy<ExecutionPolicy, ForwardIterator3> transform(ExecutionPolicy&& policy,
+    ForwardIterator1 first1, ForwardIterator1 last1, ForwardIterator2 first2,
+    ForwardIterator3 result, BinaryOperation op)
+{
+    if constexpr (__run_parallel_v<ExecutionPolicy, ForwardIterator1, ForwardIterator2,
+                      ForwardIterator3>) {
+        exec::thread_pool& pool = policy.pool();
+        const size_t n = size_t(last1 - first1);
+        const size_t pieces = __parallel_piece_count(pool, n);
+        if (pieces > 1) {
+            __parallel_pieces(pool, n, pieces,
+                [first1, first2, result, &op](size_t, size_t lo, size_t hi) {
+                    mini::algo::transform(first1 + lo, first1 + hi, first2 + lo, result + lo, op);
+                });
+            return result + n;
+        }
+    }
+    return mini::algo::transform(first1, last1, first2, result, op);
+}
+
+// copy
+
+template<typename ExecutionPolicy, typename ForwardIterator1, typename ForwardIterator2>
+__enable_if_execution_policy<ExecutionPolicy, ForwardIterator2> copy(ExecutionPolicy&& policy,
+    ForwardIterator1 first, ForwardIterator1 last, ForwardIterator2 result)
+{
+    if constexpr (__run_parallel_v<ExecutionPolicy, ForwardIterator1, ForwardIterator2>) {
+        exec::thread_pool& pool = policy.pool();
+        const size_t n = size_t(last - first);
+        const size_t pieces = __parallel_piece_count(pool, n);
+        if (pieces > 1) {
+            __parallel_pieces(pool, n, pieces, [first, result](size_t, size_t lo, size_t hi) {
+                mini::algo::copy(first + lo, first + hi, result + lo);
+            });
+            return result + n;
+        }
+    }
+    return mini::algo::copy(first, last, result);
+}
+
+// fill
+
+template<typename ExecutionPolicy, typename ForwardIterator, typename T>
+__enable_if_execution_policy<ExecutionPolicy> fill(
+    ExecutionPolicy&& policy, ForwardIterator first, ForwardIterator last, const T& value)
+{
+    if constexpr (__run_parallel_v<ExecutionPolicy, ForwardIterator>) {
+        exec::thread_pool& pool = policy.pool();
+        const size_t n = size_t(last - first);
+        const size_t pieces = __parallel_piece_count(pool, n);
+        if (pieces > 1) {
+            __parallel_pieces(pool, n, pieces, [first, &value](size_t, size_t lo, size_t hi) {
+                mini::algo::fill(first + lo, first + hi, value);
+            });
+            return;
+        }
+    }
+    mini::algo::fill(first, last, value);
+}
+
+// transform_reduce
+
+template<typename ExecutionPolicy, typename ForwardIterator, typename T, typename BinaryOperation,
+    typename UnaryOperation>
+__enable_if_execution_policy<ExecutionPolicy, T> transform_reduce(ExecutionPolicy&& policy,
+    ForwardIterator first, ForwardIterator last, T init, BinaryOperation reduce_op,
+    UnaryOperation transform_op)
+{
+    if constexpr (__run_parallel_v<ExecutionPolicy, ForwardIterator>) {
+        exec::thread_pool& pool = policy.pool();
+        const size_t n = size_t(last - first);
+        const size_t pieces = __parallel_piece_count(pool, n);
+        if (pieces > 1) {
+            ctnr::vector<T> partials(pieces, init);
+            __parallel_pieces(pool, n, pieces, [&](size_t i, size_t lo, size_t hi) {
+                ForwardIterator piece = first + lo;
+                partials[i] = mini::algo::transform_reduce(
+                    piece + 1, first + hi, T(transform_op(*piece)), reduce_op, transform_op);
+            });
+            return mini::algo::accumulate(partials.begin(), partials.end(), init, reduce_op);
+        }
+    }
+    return mini::algo::transform_reduce(first, last, init, reduce_op, transform_op);
+}
+
+template<typename ExecutionPolicy, typename ForwardIterator1, typename ForwardIterator2,
+    typename T, typename BinaryOperation1, typename BinaryOperation2>
+__enable_if_execution_policy<ExecutionPolicy, T> transform_reduce(ExecutionPolicy&& policy,
+    ForwardIterator1 first1, ForwardIterator1 last1, ForwardIterator2 first2, T init,
+    BinaryOperation1 reduce_op, BinaryOperation2 transform_op)
+{
+    if constexpr (__run_parallel_v<ExecutionPolicy, ForwardIterator1, ForwardIterator2>) {
+        exec::thread_pool& pool = policy.pool();
+        const size_t n = size_t(last1 - first1);
+        const size_t pieces = __parallel_piece_count(pool, n);
+        if (pieces > 1) {
+            ctnr::vector<T> partials(pieces, init);
+            __parallel_pieces(pool, n, pieces, [&](size_t i, size_t lo, size_t hi) {
+                ForwardIterator1 piece1 = first1 + lo;
+                ForwardIterator2 piece2 = first2 + lo;
+                partials[i] = mini::algo::transform_reduce(piece1 + 1, first1 + hi, piece2 + 1,
+                    T(transform_op(*piece1, *piece2)), reduce_op, transform_op);
+            });
+            return mini::algo::accumulate(partials.begin(), partials.end(), init, reduce_op);
+        }
+    }
+    return mini::algo::transform_reduce(first1, last1, first2, init, reduce_op, transform_op);
+}
+
+template<typename ExecutionPolicy, typename ForwardIterator1, typename ForwardIterator2,
+    typename T>
+__enable_if_execution_policy<ExecutionPolicy, T> transform_reduce(ExecutionPolicy&& policy,
+    ForwardIterator1 first1, ForwardIterator1 last1, ForwardIterator2 first2, T init)
+{
+    return mini::algo::transform_reduce(std::forward<ExecutionPolicy>(policy), first1, last1,
+        first2, init, [](const T& x, const T& y) { return x + y; },
+        [](const auto& x, const auto& y) { return x * y; });
+}
+
+// reduce
+
+/**
+ * @brief Fold a range with 'op', pieces in parallel.
+ *
+ * @attention 'op' must be associative and commutative: each piece is folded on its own, starting
+ *            from its first element, then the partial results are folded into 'init'. The
+ *            grouping depends only on the range size and the pool size, so repeated runs give
+ *            the same result, also for floating-point values.
+ */
+template<typename ExecutionPolicy, typename ForwardIterator, typename T, typename BinaryOperation>
+__enable_if_execution_policy<ExecutionPolicy, T> reduce(ExecutionPolicy&& policy,
+    ForwardIterator first, ForwardIterator last, T init, BinaryOperation op)
+{
+    return mini::algo::transform_reduce(std::forward<ExecutionPolicy>(policy), first, last, init,
+        op, [](const auto& x) -> decltype(auto) { return x; });
+}
+
+template<typename ExecutionPolicy, typename ForwardIterator, typename T>
+__enable_if_execution_policy<ExecutionPolicy, T> reduce(
+    ExecutionPolicy&& policy, ForwardIterator first, ForwardIterator last, T init)
+{
+    return mini::algo::reduce(std::forward<ExecutionPolicy>(policy), first, last, init,
+        [](const T& x, const T& y) { return x + y; });
+}
+
+template<typename ExecutionPolicy, typename ForwardIterator>
+__enable_if_execution_policy<ExecutionPolicy,
+    typename iter::iterator_traits<ForwardIterator>::value_type>
+reduce(ExecutionPolicy&& policy, ForwardIterator first, ForwardIterator last)
+{
+    typedef typename iter::iterator_traits<ForwardIterator>::value_type value_type;
+    return mini::algo::reduce(std::forward<ExecutionPolicy>(policy), first, last, value_type());
+}
+
+// sort, stable_sort
+
+// Merge the sorted ranges [first1, last1) and [first2, last2) into 'result' by moving the
+// elements. Ties are taken from the first range, which keeps the merge stable.
+template<typename InputIterator1, typename InputIterator2, typename OutputIterator,
+    typename Compare>
+OutputIterator __move_merge(InputIterator1 first1, InputIterator1 last1, InputIterator2 first2,
+    InputIterator2 last2, OutputIterator result, Compare& comp)
+{
+    while (first1 != last1 && first2 != last2) {
+        if (comp(*first2, *first1)) {
+            *result = std::move(*first2);
+            ++first2;
+        } else {
+            *result = std::move(*first1);
+            ++first1;
+        }
+        ++result;
+    }
+    result = mini::algo::move(first1, last1, result);
+    return mini::algo::move(first2, last2, result);
+}
+
+// Stable merge of two sorted ranges into 'result', cut into pieces of at most 'grain' elements
+// merged in parallel. The middle element of the longer range splits it, and a binary search
+// splits the other range around that element; the upper halves are handed to the group.
+template<typename RandomAccessIterator1, typename RandomAccessIterator2,
+    typename RandomAccessIterator3, typename Compare>
+void __parallel_move_merge(exec::task_group& group, RandomAccessIterator1 first1,
+    RandomAccessIterator1 last1, RandomAccessIterator2 first2, RandomAccessIterator2 last2,
+    RandomAccessIterator3 result, size_t grain, Compare& comp)
+{
+    while (size_t((last1 - first1) + (last2 - first2)) > grain) {
+        RandomAccessIterator1 middle1;
+        RandomAccessIterator2 middle2;
+        if (last1 - first1 >= last2 - first2) {
+            // elements of the second range equal to *middle1 must follow it
+            middle1 = first1 + (last1 - first1) / 2;
+            middle2 = mini::algo::__lower_bound(first2, last2, *middle1, comp);
+        } else {
+            // elements of the first range equal to *middle2 must precede it
+            middle2 = first2 + (last2 - first2) / 2;
+            middle1 = mini::algo::__upper_bound(first1, last1, *middle2, comp);
+        }
+        RandomAccessIterator3 middle_result = result + ((middle1 - first1) + (middle2 - first2));
+        group.run([&group, middle1, last1, middle2, last2, middle_result, grain, &comp] {
+            mini::algo::__parallel_move_merge(
+                group, middle1, last1, middle2, last2, middle_result, grain, comp);
+        });
+        last1 = middle1;
+        last2 = middle2;
+    }
+    mini::algo::__move_merge(first1, last1, first2, last2, result, comp);
+}
+
+/**
+ * @brief Parallel merge sort of [first, first + n) through 'buffer', which holds n constructed
+ *        elements (or raw storage, for trivially copyable ones). The elements start in the
+ *        buffer if 'in_buffer' is set, and always end in the range.
+ *
+ * @attention The range is cut into 'pieces' runs sorted in parallel by sort() (or stable_sort()
+ *            if 'stable' is set), then adjacent runs are merged pairwise, between the range and
+ *            the buffer, until one run is left. Every merge is itself split across the pool, so
+ *            the last rounds, with fewer runs than workers, still use all of them.
+ */
+template<typename RandomAccessIterator, typename T, typename Compare>
+void __parallel_merge_sort(exec::thread_pool& pool, RandomAccessIterator first, size_t n,
+    size_t pieces, T* buffer, Compare& comp, bool stable, bool in_buffer)
+{
+    __parallel_pieces(pool, n, pieces, [=, &comp](size_t, size_t lo, size_t hi) {
+        if (in_buffer && stable) {
+            mini::algo::stable_sort(buffer + lo, buffer + hi, comp);
+        } else if (in_buffer) {
+            mini::algo::sort(buffer + lo, buffer + hi, comp);
+        } else if (stable) {
+            mini::algo::stable_sort(first + lo, first + hi, comp);
+        } else {
+            mini::algo::sort(first + lo, first + hi, comp);
+        }
+    });
+
+    // runs[i] is the start of run i, runs[count] == n; same cuts as __parallel_pieces()
+    ctnr::vector<size_t> runs(pieces + 1);
+    for (size_t i = 0; i <= pieces; ++i) {
+        runs[i] = n / pieces * i + n % pieces * i / pieces;
+    }
+    const size_t grain = n / (pool.size() * __parallel_pieces_per_worker) + 1;
+    for (size_t count = pieces; count > 1; count = (count + 1) / 2) {
+        {
+            exec::task_group group(pool);
+            for (size_t i = 0; i + 1 < count; i += 2) {
+                const size_t lo = runs[i], mid = runs[i + 1], hi = runs[i + 2];
+                if (in_buffer) {
+                    mini::algo::__parallel_move_merge(group, buffer + lo, buffer + mid,
+                        buffer + mid, buffer + hi, first + lo, grain, comp);
+                } else {
+                    mini::algo::__parallel_move_merge(group, first + lo, first + mid,
+                        first + mid, first + hi, buffer + lo, grain, comp);
+                }
+            }
+            if (count % 2 != 0) {
+                // odd run out: moved as is, so that the whole sequence switches sides
+                const size_t lo = runs[count - 1], hi = runs[count];
+                group.run([=] {
+                    if (in_buffer) {
+                        mini::algo::move(buffer + lo, buffer + hi, first + lo);
+                    } else {
+                        mini::algo::move(first + lo, first + hi, buffer + lo);
+                    }
+                });
+            }
+            group.wait();
+        }
+        // run i of the next round is made of runs 2i and 2i + 1
+        const size_t next_count = (count + 1) / 2;
+        for (size_t i = 1; i <= next_count; ++i) {
+            runs[i] = runs[2 * i < count ? 2 * i : count];
+        }
+        in_buffer = !in_buffer;
+    }
+    if (in_buffer) {
+        __parallel_pieces(pool, n, pieces, [first, buffer](size_t, size_t lo, size_t hi) {
+            mini::algo::move(buffer + lo, buffer + hi, first + lo);
+        });
+    }
+}
+
+template<typename ExecutionPolicy, typename RandomAccessIterator, typename Compare>
+void __parallel_sort(ExecutionPolicy& policy, RandomAccessIterator first,
+    RandomAccessIterator last, Compare& comp, bool stable)
+{
+    typedef typename iter::iterator_traits<RandomAccessIterator>::value_type T;
+    if constexpr (__run_parallel_v<ExecutionPolicy, RandomAccessIterator>) {
+        exec::thread_pool& pool = policy.pool();
+        const size_t n = size_t(last - first);
+        const size_t pieces = __parallel_piece_count(pool, n);
+        if (pieces > 1) {
+            const ptrdiff_t len = last - first;
+            __temporary_buffer<T> buffer(len);
+            if (buffer.size() == len) {
+                if constexpr (std::is_trivially_copyable_v<T>) {
+                    mini::algo::__parallel_merge_sort(
+                        pool, first, n, pieces, buffer.begin(), comp, stable, false);
+                } else {
+                    // the buffer is made of the elements themselves, moved out of the range
+                    T* buf = buffer.begin();
+                    mini::algo::__parallel_uninitialized_move(pool, first, n, pieces, buf);
+                    try {
+                        mini::algo::__parallel_merge_sort(
+                            pool, first, n, pieces, buf, comp, stable, true);
+                    } catch (...) {
+                        mem::destroy(buf, buf + n);
+                        throw;
+                    }
+                    mem::destroy(buf, buf + n);
+                }
+                return;
+            }
+        }
+    }
+    if (stable) {
+        mini::algo::stable_sort(first, last, comp);
+    } else {
+        mini::algo::sort(first, last, comp);
+    }
+}
+
+/**
+ * @brief Sort [first, last) in ascending order of 'comp', the work split across the pool.
+ *        Not stable.
+ *
+ * @attention Parallel merge sort: a few runs per worker are sorted by sort(), then merged in
+ *            parallel through a temporary buffer of n elements. Falls back to the sequential
+ *            sort() for small ranges, single-worker pools, exec::seq, and without memory for
+ *            the buffer.
+ * @attention If 'comp' throws, the exception is rethrown and the range holds its elements in an
+ *            unspecified order, some of them possibly moved-from.
+ */
+template<typename ExecutionPolicy, typename RandomAccessIterator, typename Compare>
+__enable_if_execution_policy<ExecutionPolicy> sort(ExecutionPolicy&& policy,
+    RandomAccessIterator first, RandomAccessIterator last, Compare comp)
+{
+    mini::algo::__parallel_sort(policy, first, last, comp, false);
+}
+
+template<typename ExecutionPolicy, typename RandomAccessIterator>
+__enable_if_execution_policy<ExecutionPolicy> sort(
+    ExecutionPolicy&& policy, RandomAccessIterator first, RandomAccessIterator last)
+{
+    mini::algo::sort(std::forward<ExecutionPolicy>(policy), first, last, func::less<>());
+}
+
+/**
+ * @brief Sort [first, last) in ascending order of 'comp', keeping the order of equal elements,
+ *        the work split across the pool.
+ *
+ * @attention Same as the parallel sort(), with runs sorted by stable_sort(): every merge takes
+ *            ties from the earlier run.
+ */
+template<typename ExecutionPolicy, typename RandomAccessIterator, typename Compare>
+__enable_if_execution_policy<ExecutionPolicy> stable_sort(ExecutionPolicy&& policy,
+    RandomAccessIterator first, RandomAccessIterator last, Compare comp)
+{
+    mini::algo::__parallel_sort(policy, first, last, comp, true);
+}
+
+template<typename ExecutionPolicy, typename RandomAccessIterator>
+__enable_if_execution_policy<ExecutionPolicy> stable_sort(
+    ExecutionPolicy&& policy, RandomAccessIterator first, RandomAccessIterator last)
+{
+    mini::algo::stable_sort(std::forward<ExecutionPolicy>(policy), first, last, func::less<>());
+}
+
+// radix_sort
+
+/**
+ * @brief Parallel LSD radix sort of [first, first + n) through 'buffer', one piece per worker.
+ *        Same contract as __radix_sort_lsd().
+ *
+ * @attention Each pass counts the digit per piece, turns the counts into per-piece offsets
+ *            (bucket-major, piece-minor, which keeps the sort stable) and scatters the pieces
+ *            concurrently: every piece writes to its own slots of every bucket.
+ */
+template<typename RandomAccessIterator, typename T, typename KeyOf>
+void __parallel_radix_sort_lsd(exec::thread_pool& pool, RandomAccessIterator first, size_t n,
+    size_t pieces, T* buffer, KeyOf& key_of, bool in_buffer)
+{
+    typedef __radix_key<__radix_key_of_t<RandomAccessIterator, KeyOf>> radix_key;
+    typedef typename radix_key::type key_type;
+    constexpr int passes = sizeof(key_type) * 8 / __radix_bits;
+    constexpr size_t buckets = __radix_buckets;
+
+    // counts[(piece * passes + pass) * buckets + bucket], first for the initial layout
+    ctnr::vector<size_t> counts(pieces * passes * buckets, 0);
+    __parallel_pieces(pool, n, pieces, [&](size_t i, size_t lo, size_t hi) {
+        size_t* c = &counts[i * passes * buckets];
+        for (size_t j = lo; j < hi; ++j) {
+            key_type key = radix_key::map(key_of(in_buffer ? buffer[j] : *(first + j)));
+            for (int pass = 0; pass < passes; ++pass) {
+                ++c[pass * buckets + (key & (buckets - 1))];
+                key = key_type(key >> __radix_bits);
+            }
+        }
+    });
+
+    ctnr::vector<size_t> offsets(pieces * buckets, 0);
+    bool moved = false;  // a pass moved the elements: the per-piece counts must be redone
+    for (int pass = 0; pass < passes; ++pass) {
+        const int shift = pass * __radix_bits;
+        auto count_of = [&](size_t piece, size_t bucket) -> size_t& {
+            return counts[(piece * passes + pass) * buckets + bucket];
+        };
+
+        // digit totals do not depend on the layout
+        bool trivial = false;
+        for (size_t b = 0; b < buckets && !trivial; ++b) {
+            size_t total = 0;
+            for (size_t i = 0; i < pieces; ++i) {
+                total += count_of(i, b);
+            }
+            trivial = total == n;
+        }
+        if (trivial) {
+            continue;
+        }
+
+        if (moved) {
+            __parallel_pieces(pool, n, pieces, [&](size_t i, size_t lo, size_t hi) {
+                for (size_t b = 0; b < buckets; ++b) {
+                    count_of(i, b) = 0;
+                }
+                for (size_t j = lo; j < hi; ++j) {
+                    const auto& value = in_buffer ? buffer[j] : *(first + j);
+                    ++count_of(i, __radix_digit<radix_key>(key_of, value, shift));
+                }
+            });
+        }
+
+        size_t offset = 0;
+        for (size_t b = 0; b < buckets; ++b) {
+            for (size_t i = 0; i < pieces; ++i) {
+                offsets[i * buckets + b] = offset;
+                offset += count_of(i, b);
+            }
+        }
+
+        __parallel_pieces(pool, n, pieces, [&](size_t i, size_t lo, size_t hi) {
+            size_t* o = &offsets[i * buckets];
+            if (!in_buffer) {
+                for (size_t j = lo; j < hi; ++j) {
+                    auto&& value = *(first + j);
+                    mini::algo::__radix_put(
+                        buffer + o[__radix_digit<radix_key>(key_of, value, shift)]++,
+                        std::move(value));
+                }
+            } else {
+                for (size_t j = lo; j < hi; ++j) {
+                    *(first + o[__radix_digit<radix_key>(key_of, buffer[j], shift)]++) =
+                        std::move(buffer[j]);
+                }
+            }
+        });
+        in_buffer = !in_buffer;
+        moved = true;
+    }
+    if (in_buffer) {
+        __parallel_pieces(pool, n, pieces, [&](size_t, size_t lo, size_t hi) {
+            mini::algo::move(buffer + lo, buffer + hi, first + lo);
+        });
+    }
+}
+
+/**
+ * @brief Sort [first, last) by key_of(element), stable, the passes split across the pool.
+ *
+ * @attention Falls back to the sequential radix_sort() for small ranges, single-worker pools and
+ *            exec::seq, and to stable_sort() without memory for the n-element buffer.
+ */
+template<typename ExecutionPolicy, typename RandomAccessIterator, typename KeyOf>
+__enable_if_execution_policy<ExecutionPolicy> radix_sort(ExecutionPolicy&& policy,
+    RandomAccessIterator first, RandomAccessIterator last, KeyOf key_of)
+{
+    typedef typename iter::iterator_traits<RandomAccessIterator>::value_type T;
+    if constexpr (__run_parallel_v<ExecutionPolicy, RandomAccessIterator>) {
+        exec::thread_pool& pool = policy.pool();
+        const size_t n = size_t(last - first);
+        // one piece per worker: the work per element is uniform, and fewer pieces keep the
+        // per-piece histograms small
+        size_t pieces = n / __parallel_min_grain;
+        if (pieces > pool.size()) {
+            pieces = pool.size();
+        }
+        if (pieces > 1) {
+            const ptrdiff_t len = last - first;
+            __temporary_buffer<T> buffer(len);
+            if (buffer.size() == len) {
+                if constexpr (std::is_trivially_copyable_v<T>) {
+                    mini::algo::__parallel_radix_sort_lsd(
+                        pool, first, n, pieces, buffer.begin(), key_of, false);
+                } else {
+                    T* buf = buffer.begin();
+                    mini::algo::__parallel_uninitialized_move(pool, first, n, pieces, buf);
+                    try {
+                        mini::algo::__parallel_radix_sort_lsd(
+                            pool, first, n, pieces, buf, key_of, true);
+                    } catch (...) {
+                        mem::destroy(buf, buf + n);
+                        throw;
+                    }
+                    mem::destroy(buf, buf + n);
+                }
+                return;
+            }
+        }
+    }
+    mini::algo::radix_sort(first, last, key_of);
+}
+
+template<typename ExecutionPolicy, typename RandomAccessIterator>
+__enable_if_execution_policy<ExecutionPolicy> radix_sort(
+    ExecutionPolicy&& policy, RandomAccessIterator first, RandomAccessIterator last)
+{
+    mini::algo::radix_sort(std::forward<ExecutionPolicy>(policy), first, last, func::identity());
+}
+
+}  // namespace mini::algo
+
+#endif
@@ -0,0 +1,297 @@
+#ifndef MINI_ALGORITHM_RADIX_SORT_H
+#define MINI_ALGORITHM_RADIX_SORT_H
+
+#include "mini_stl/algorithm/mini_algorithm_base.h"
+#include "mini_stl/algorithm/mini_algorithm_sort.h"
+#include "mini_stl/functional/mini_functional_base.h"
+#include "mini_stl/iterator/mini_iterator_base.h"
+#include "mini_stl/memory/mini_memory_construct.h"
+#include "mini_stl/memory/mini_memory_uninitialized.h"
+
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include <utility>
+
+namespace mini::algo {
+
+/**
+ * @brief Order-preserving map of an arithmetic key to an unsigned integer of the same width:
+ *        x < y if and only if map(x) < map(y).
+ *
+ * @attention Signed integers get their sign bit flipped. Floating-point values get their sign
+ *            bit flipped if positive, all bits flipped if negative, so -0.0 sorts before +0.0
+ *            and NaNs sort after +inf (before -inf if the sign bit is set).
+ */
+template<typename Key, typename = void>
+struct __radix_key {
+    static_assert(sizeof(Key) == 0, "radix sort keys must be integral or floating-point values");
+};
+
+template<typename Key>
+struct __radix_key<Key, std::enable_if_t<std::is_integral_v<Key>>> {
+    static_assert(!std::is_same_v<Key, bool>, "bool keys are not supported");
+
+    typedef std::make_unsigned_t<Key> type;
+
+    static type map(Key key)
+    {
+        if constexpr (std::is_signed_v<Key>) {
+            return type(key) ^ (type(1) << (sizeof(Key) * 8 - 1));
+        } else {
+            return key;
+        }
+    }
+};
+
+template<typename Key>
+struct __radix_key<Key, std::enable_if_t<std::is_floating_point_v<Key>>> {
+    static_assert(sizeof(Key) == 4 || sizeof(Key) == 8, "only 32 and 64-bit floating point keys");
+
+    typedef std::conditional_t<sizeof(Key) == 4, uint32_t, uint64_t> type;
+
+    static type map(Key key)
+    {
+        type bits;
+        std::memcpy(&bits, &key, sizeof(bits));
+        const type sign = type(1) << (sizeof(type) * 8 - 1);
+        return (bits & sign) ? ~bits : (bits | sign);
+    }
+};
+
+// Key type returned by 'KeyOf' for an element of the range
+template<typename RandomAccessIterator, typename KeyOf>
+using __radix_key_of_t = std::decay_t<std::invoke_result_t<KeyOf&,
+    const typename iter::iterator_traits<RandomAccessIterator>::value_type&>>;
+
+// The radix is one byte: 256 buckets, sizeof(key) passes
+inline constexpr int __radix_bits = 8;
+inline constexpr size_t __radix_buckets = size_t(1) << __radix_bits;
+
+// Ranges at most this long are insertion sorted
+inline constexpr ptrdiff_t __radix_insertion_threshold = 64;
+
+// Compare elements by their mapped keys
+template<typename RadixKey, typename KeyOf>
+struct __radix_compare {
+    KeyOf& key_of;
+
+    template<typename T>
+    bool operator()(const T& x, const T& y) const
+    {
+        return RadixKey::map(key_of(x)) < RadixKey::map(key_of(y));
+    }
+};
+
+// Bucket of 'value' at the digit starting at bit 'shift'
+template<typename RadixKey, typename KeyOf, typename T>
+inline size_t __radix_digit(KeyOf& key_of, const T& value, int shift)
+{
+    return size_t(RadixKey::map(key_of(value)) >> shift) & (__radix_buckets - 1);
+}
+
+//// LSD ////
+
+// Move 'value' to buffer slot 'slot': the buffer of trivially copyable elements is raw storage,
+// in which the element is constructed, the other buffers hold elements assigned to
+template<typename T, typename U>
+inline void __radix_put(T* slot, U&& value)
+{
+    if constexpr (std::is_trivially_copyable_v<T>) {
+        mem::construct(slot, std::forward<U>(value));
+    } else {
+        *slot = std::forward<U>(value);
+    }
+}
+
+/**
+ * @brief LSD radix sort of [first, first + n) through 'buffer', which holds n constructed
+ *        elements (or raw storage, for trivially copyable ones). The elements start in the
+ *        buffer if 'in_buffer' is set, and always end in the range.
+ *
+ * @attention One read pass builds the histograms of every digit, then each pass scatters the
+ *            elements by one digit between the range and the buffer. A digit on which every
+ *            element agrees is skipped, so small key ranges cost few passes.
+ */
+template<typename RandomAccessIterator, typename T, typename KeyOf>
+void __radix_sort_lsd(
+    RandomAccessIterator first, size_t n, T* buffer, KeyOf& key_of, bool in_buffer)
+{
+    typedef __radix_key<__radix_key_of_t<RandomAccessIterator, KeyOf>> radix_key;
+    typedef typename radix_key::type key_type;
+    constexpr int passes = sizeof(key_type) * 8 / __radix_bits;
+
+    size_t counts[passes][__radix_buckets] = {};
+    for (size_t i = 0; i < n; ++i) {
+        key_type key = radix_key::map(key_of(in_buffer ? buffer[i] : *(first + i)));
+        for (int pass = 0; pass < passes; ++pass) {
+            ++counts[pass][key & (__radix_buckets - 1)];
+            key = key_type(key >> __radix_bits);
+        }
+    }
+
+    for (int pass = 0; pass < passes; ++pass) {
+        size_t offsets[__radix_buckets];
+        size_t offset = 0;
+        bool trivial = false;
+        for (size_t b = 0; b < __radix_buckets; ++b) {
+            trivial = trivial || counts[pass][b] == n;
+            offsets[b] = offset;
+            offset += counts[pass][b];
+        }
+        if (trivial) {
+            continue;  // every element has the same digit: the pass would not move anything
+        }
+        const int shift = pass * __radix_bits;
+        if (!in_buffer) {
+            for (size_t i = 0; i < n; ++i) {
+                auto&& value = *(first + i);
+                mini::algo::__radix_put(
+                    buffer + offsets[__radix_digit<radix_key>(key_of, value, shift)]++,
+                    std::move(value));
+            }
+        } else {
+            for (size_t i = 0; i < n; ++i) {
+                *(first + offsets[__radix_digit<radix_key>(key_of, buffer[i], shift)]++) =
+                    std::move(buffer[i]);
+            }
+        }
+        in_buffer = !in_buffer;
+    }
+    if (in_buffer) {
+        mini::algo::move(buffer, buffer + n, first);
+    }
+}
+
+/**
+ * @brief Sort [first, last) by the arithmetic key key_of(element). Stable.
+ *
+ * @attention LSD radix sort, one byte per pass: O(n * sizeof(key)), with a temporary buffer of
+ *            n elements. Without memory for it, falls back to stable_sort().
+ * @param key_of Returns the key of an element: an integral or floating-point value
+ */
+template<typename RandomAccessIterator, typename KeyOf>
+void radix_sort(RandomAccessIterator first, RandomAccessIterator last, KeyOf key_of)
+{
+    typedef typename iter::iterator_traits<RandomAccessIterator>::value_type T;
+    typedef __radix_key<__radix_key_of_t<RandomAccessIterator, KeyOf>> radix_key;
+
+    const ptrdiff_t n = last - first;
+    __radix_compare<radix_key, KeyOf> comp{key_of};
+    if (n <= __radix_insertion_threshold) {
+        mini::algo::__insertion_sort(first, last, comp);
+        return;
+    }
+    __temporary_buffer<T> buffer(n);
+    if (buffer.size() != n) {
+        mini::algo::stable_sort(first, last, comp);
+        return;
+    }
+    if constexpr (std::is_trivially_copyable_v<T>) {
+        mini::algo::__radix_sort_lsd(first, size_t(n), buffer.begin(), key_of, false);
+    } else {
+        // the buffer is made of the elements themselves, moved out of the range
+        T* buffer_end = mem::uninitialized_move(first, last, buffer.begin());
+        try {
+            mini::algo::__radix_sort_lsd(first, size_t(n), buffer.begin(), key_of, true);
+        } catch (...) {
+            mem::destroy(buffer.begin(), buffer_end);
+            throw;
+        }
+        mem::destroy(buffer.begin(), buffer_end);
+    }
+}
+
+template<typename RandomAccessIterator>
+void radix_sort(RandomAccessIterator first, RandomAccessIterator last)
+{
+    mini::algo::radix_sort(first, last, func::identity());
+}
+
+//// MSD ////
+
+// American flag sort of [first, last) on the digit at 'shift' and the lower ones
+template<typename RandomAccessIterator, typename KeyOf>
+void __radix_sort_msd(
+    RandomAccessIterator first, RandomAccessIterator last, int shift, KeyOf& key_of)
+{
+    typedef __radix_key<__radix_key_of_t<RandomAccessIterator, KeyOf>> radix_key;
+
+    for (;;) {
+        const ptrdiff_t n = last - first;
+        if (n <= __radix_insertion_threshold) {
+            // small or heavily skewed buckets: cheaper than another histogram
+            mini::algo::__insertion_sort(first, last, __radix_compare<radix_key, KeyOf>{key_of});
+            return;
+        }
+
+        ptrdiff_t counts[__radix_buckets] = {};
+        for (RandomAccessIterator it = first; it != last; ++it) {
+            ++counts[__radix_digit<radix_key>(key_of, *it, shift)];
+        }
+        ptrdiff_t starts[__radix_buckets];
+        ptrdiff_t next[__radix_buckets];
+        ptrdiff_t offset = 0;
+        bool trivial = false;
+        for (size_t b = 0; b < __radix_buckets; ++b) {
+            trivial = trivial || counts[b] == n;
+            starts[b] = next[b] = offset;
+            offset += counts[b];
+        }
+
+        if (!trivial) {
+            // swap every element into its bucket: each swap places at least one element for good
+            for (size_t b = 0; b < __radix_buckets; ++b) {
+                const ptrdiff_t end = starts[b] + counts[b];
+                while (next[b] < end) {
+                    const size_t d = __radix_digit<radix_key>(key_of, *(first + next[b]), shift);
+                    if (d == b) {
+                        ++next[b];
+                    } else {
+                        mini::algo::iter_swap(first + next[b], first + next[d]++);
+                    }
+                }
+            }
+        }
+        if (shift == 0) {
+            return;
+        }
+        shift -= __radix_bits;
+        if (trivial) {
+            continue;  // same digit everywhere: go straight to the next one
+        }
+        for (size_t b = 0; b < __radix_buckets; ++b) {
+            if (counts[b] > 1) {
+                mini::algo::__radix_sort_msd(
+                    first + starts[b], first + (starts[b] + counts[b]), shift, key_of);
+            }
+        }
+        return;
+    }
+}
+
+/**
+ * @brief Sort [first, last) by the arithmetic key key_of(element), in place. Not stable.
+ *
+ * @attention MSD radix sort (American flag sort): elements are swapped into their buckets, then
+ *            each bucket is sorted on the next byte. Buckets of at most 64 elements are insertion
+ *            sorted, so skewed key distributions do not pay for 256-bucket histograms on tiny
+ *            ranges. No extra memory; O(n * sizeof(key)).
+ */
+template<typename RandomAccessIterator, typename KeyOf>
+void radix_sort_msd(RandomAccessIterator first, RandomAccessIterator last, KeyOf key_of)
+{
+    typedef __radix_key<__radix_key_of_t<RandomAccessIterator, KeyOf>> radix_key;
+    constexpr int top_shift = int(sizeof(typename radix_key::type) * 8) - __radix_bits;
+    mini::algo::__radix_sort_msd(first, last, top_shift, key_of);
+}
+
+template<typename RandomAccessIterator>
+void radix_sort_msd(RandomAccessIterator first, RandomAccessIterator last)
+{
+    mini::algo::radix_sort_msd(first, last, func::identity());
+}
+
+}  // namespace mini::algo
+
+#endif
@@ -0,0 +1,151 @@
+#ifndef MINI_ALGORITHM_SEARCH_H
+#define MINI_ALGORITHM_SEARCH_H
+
+#include "mini_stl/functional/mini_functional_relational.h"
+#include "mini_stl/iterator/mini_iterator_base.h"
+#include "mini_stl/utility/mini_utility_base.h"
+
+#include <type_traits>
+
+namespace mini::algo {
+
+//// lower_bound, upper_bound ////
+
+// Classic halving search for iterators without random access. 'Upper' selects upper_bound.
+template<bool Upper, typename ForwardIterator, typename T, typename Compare>
+ForwardIterator __bound(ForwardIterator first, ForwardIterator last, const T& value,
+    Compare& comp, iter::forward_iterator_tag)
+{
+    typename iter::iterator_traits<ForwardIterator>::difference_type len =
+        iter::distance(first, last);
+    while (len > 0) {
+        const auto half = len / 2;
+        ForwardIterator mid = first;
+        iter::advance(mid, half);
+        if (Upper ? !comp(value, *mid) : comp(*mid, value)) {
+            first = ++mid;
+            len -= half + 1;
+        } else {
+            len = half;
+        }
+    }
+    return first;
+}
+
+/**
+ * @brief Branchless binary search: the loop only narrows an offset, the comparison result
+ *        selects the new offset with a conditional move instead of a branch.
+ *
+ * @attention The number of iterations depends on the length only, so no branch is mispredicted
+ *            on random keys. On contiguous ranges both candidate probes of the next iteration
+ *            are prefetched, which overlaps the cache misses of consecutive levels once the
+ *            range no longer fits in the cache.
+ */
+template<bool Upper, typename RandomAccessIterator, typename T, typename Compare>
+RandomAccessIterator __bound(RandomAccessIterator first, RandomAccessIterator last,
+    const T& value, Compare& comp, iter::random_access_iterator_tag)
+{
+    typedef typename iter::iterator_traits<RandomAccessIterator>::difference_type Distance;
+
+    Distance len = last - first;
+    if (len == 0) {
+        return first;
+    }
+    Distance base = 0;
+    while (len > 1) {
+        const Distance half = len / 2;
+        if constexpr (std::is_convertible_v<
+                          typename iter::iterator_traits<RandomAccessIterator>::iterator_category,
+                          iter::contiguous_iterator_tag>) {
+            const Distance next_half = (len - half) / 2;
+            __builtin_prefetch(iter::__to_address(first) + (base + next_half));
+            __builtin_prefetch(iter::__to_address(first) + (base + half + next_half));
+        }
+        const auto& probe = *(first + (base + half));
+        base = (Upper ? !comp(value, probe) : comp(probe, value)) ? base + half : base;
+        len -= half;
+    }
+    const auto& probe = *(first + base);
+    return first + (base + Distance(Upper ? !comp(value, probe) : comp(probe, value)));
+}
+
+/**
+ * @brief First position in sorted [first, last) where 'value' could be inserted, before the
+ *        elements equal to it
+ *
+ * @attention O(log n) comparisons. Branchless on random access iterators, prefetching on
+ *            contiguous ones.
+ */
+template<typename ForwardIterator, typename T, typename Compare>
+ForwardIterator lower_bound(
+    ForwardIterator first, ForwardIterator last, const T& value, Compare comp)
+{
+    return mini::algo::__bound<false>(first, last, value, comp, iter::iterator_category(first));
+}
+
+template<typename ForwardIterator, typename T>
+ForwardIterator lower_bound(ForwardIterator first, ForwardIterator last, const T& value)
+{
+    return mini::algo::lower_bound(first, last, value, func::less<>());
+}
+
+/**
+ * @brief Last position in sorted [first, last) where 'value' could be inserted, after the
+ *        elements equal to it
+ *
+ * @attention O(log n) comparisons. Branchless on random access iterators, prefetching on
+ *            contiguous ones.
+ */
+template<typename ForwardIterator, typename T, typename Compare>
+ForwardIterator upper_bound(
+    ForwardIterator first, ForwardIterator last, const T& value, Compare comp)
+{
+    return mini::algo::__bound<true>(first, last, value, comp, iter::iterator_category(first));
+}
+
+template<typename ForwardIterator, typename T>
+ForwardIterator upper_bound(ForwardIterator first, ForwardIterator last, const T& value)
+{
+    return mini::algo::upper_bound(first, last, value, func::less<>());
+}
+
+//// equal_range, binary_search ////
+
+/**
+ * @brief The range of the elements equal to 'value' in sorted [first, last)
+ */
+template<typename ForwardIterator, typename T, typename Compare>
+util::pair<ForwardIterator, ForwardIterator> equal_range(
+    ForwardIterator first, ForwardIterator last, const T& value, Compare comp)
+{
+    ForwardIterator lower = mini::algo::lower_bound(first, last, value, comp);
+    return util::pair<ForwardIterator, ForwardIterator>(
+        lower, mini::algo::upper_bound(lower, last, value, comp));
+}
+
+template<typename ForwardIterator, typename T>
+util::pair<ForwardIterator, ForwardIterator> equal_range(
+    ForwardIterator first, ForwardIterator last, const T& value)
+{
+    return mini::algo::equal_range(first, last, value, func::less<>());
+}
+
+/**
+ * @brief Whether sorted [first, last) contains an element equal to 'value'
+ */
+template<typename ForwardIterator, typename T, typename Compare>
+bool binary_search(ForwardIterator first, ForwardIterator last, const T& value, Compare comp)
+{
+    first = mini::algo::lower_bound(first, last, value, comp);
+    return first != last && !comp(value, *first);
+}
+
+template<typename ForwardIterator, typename T>
+bool binary_search(ForwardIterator first, ForwardIterator last, const T& value)
+{
+    return mini::algo::binary_search(first, last, value, func::less<>());
+}
+
+}  // namespace mini::algo
+
+#endif
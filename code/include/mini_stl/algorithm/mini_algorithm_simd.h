@@ -0,0 +1,765 @@
+#ifndef MINI_ALGORITHM_SIMD_H
+#define MINI_ALGORITHM_SIMD_H
+
+#include "mini_stl/base/mini_base_type_traits.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+#if defined(__GNUC__) && defined(__x86_64__)
+#define MINI_SIMD_X86 1
+#include <immintrin.h>
+#else
+#define MINI_SIMD_X86 0
+#endif
+
+// Vectorized linear scans over contiguous arithmetic elements: find, count, mismatch and the
+// minimum/maximum value. The algorithms of mini_algorithm_base.h call them for pointer ranges
+// (vector iterators, deque buffers) of the eligible types.
+//
+// On x86-64, SSE2 is always there; AVX2 and AVX-512 (F + BW) kernels are compiled through
+// per-function target attributes, without global compiler flags, and picked at run time from
+// the CPU features. Other targets get the scalar loops.
+//
+// A kernel is written once against an 'ops' interface (load, set1, lane-wise compare to a
+// bitmask, min/max, NaN test) and always inlined into one entry point per instruction set, so
+// the intrinsics of each set only ever run in a function compiled for it.
+
+#if MINI_SIMD_X86
+// The kernels pass vectors around by value; they are always inlined into an entry point of the
+// matching instruction set, so the ABI note GCC emits for the generic templates does not apply.
+// Vector types lose their alignment attribute as template arguments (std::conditional_t), which
+// only matters for aligned loads and stores: every access here is unaligned. GCC 12 also flags
+// the undefined pass-through vector of the AVX-512 min/max intrinsics as uninitialized.
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wpsabi"
+#pragma GCC diagnostic ignored "-Wignored-attributes"
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+
+#define MINI_SIMD_INLINE inline __attribute__((always_inline))
+// every CPU with AVX2 has POPCNT
+#define MINI_SIMD_TARGET_AVX2 __attribute__((target("avx2,popcnt")))
+#define MINI_SIMD_TARGET_AVX512 __attribute__((target("avx512f,avx512bw,popcnt")))
+#endif
+
+namespace mini::algo {
+
+/**
+ * @brief Element types the kernels handle: integers of 1 to 8 bytes (bool excepted), float and
+ *        double. Elements are compared by value, as by operator== and operator<.
+ */
+template<typename T>
+inline constexpr bool __simd_scannable_v =
+    std::is_same_v<typename type_traits::__type_traits<T>::is_arithmetic_type,
+        type_traits::__true_type>
+    && !std::is_same_v<T, bool>
+    && (std::is_integral_v<T> ? sizeof(T) <= 8
+                              : std::is_same_v<T, float> || std::is_same_v<T, double>);
+
+/**
+ * @brief Convert 'value' into 'key' of element type T such that, for every element x,
+ *        x == value if and only if x == key.
+ *
+ * @return bool false if there is no such key (or the types are not scannable): the caller
+ *         falls back to the scalar loop. Integers convert if the value round-trips; floating
+ *         point values only match their own type.
+ */
+template<typename T, typename U>
+inline bool __simd_key(const U& value, T& key)
+{
+    if constexpr (!__simd_scannable_v<T> || !__simd_scannable_v<U>) {
+        return false;
+    } else if constexpr (std::is_integral_v<T> && std::is_integral_v<U>) {
+        key = T(value);
+        return U(key) == value;
+    } else if constexpr (std::is_same_v<T, U>) {
+        key = value;
+        return true;
+    } else {
+        return false;
+    }
+}
+
+// Instruction sets, in increasing order
+enum __simd_level { __simd_scalar, __simd_sse2, __simd_avx2, __simd_avx512 };
+
+inline __simd_level __simd_detect_level()
+{
+#if MINI_SIMD_X86
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512bw")) {
+        return __simd_avx512;
+    }
+    if (__builtin_cpu_supports("avx2")) {
+        return __simd_avx2;
+    }
+    return __simd_sse2;
+#else
+    return __simd_scalar;
+#endif
+}
+
+// Best instruction set of the running CPU, detected once
+inline __simd_level __simd_cpu_level()
+{
+    static const __simd_level level = __simd_detect_level();
+    return level;
+}
+
+#if MINI_SIMD_X86
+
+//// ops ////
+
+// Each ops class provides, for lanes of type T:
+//   vec, lanes       vector type and number of lanes
+//   mask_bits        bits per lane in the masks returned by eq() (2 for 16-bit lanes on SSE2 and
+//                    AVX2, whose masks have one bit per byte)
+//   has_minmax       whether min() and max() exist
+//   load(p), store(p, x), set1(value)
+//   eq(x, y)         mask of the lanes where x == y
+//   unordered(x)     mask of the NaN lanes, 0 for integers
+//   min(x, y), max(x, y)
+//   popcount(mask)   number of bits set
+
+template<typename T>
+struct __simd_ops_sse2 {
+    typedef std::conditional_t<std::is_same_v<T, float>, __m128,
+        std::conditional_t<std::is_same_v<T, double>, __m128d, __m128i>> vec;
+
+    static constexpr size_t lanes = 16 / sizeof(T);
+    static constexpr int mask_bits = sizeof(T) == 2 ? 2 : 1;
+    // no 64-bit integer compare before SSE4.2
+    static constexpr bool has_minmax = std::is_floating_point_v<T> || sizeof(T) < 8;
+
+    static vec load(const T* p)
+    {
+        if constexpr (std::is_same_v<T, float>) {
+            return _mm_loadu_ps(p);
+        } else if constexpr (std::is_same_v<T, double>) {
+            return _mm_loadu_pd(p);
+        } else {
+            return _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+        }
+    }
+
+    static void store(T* p, vec x)
+    {
+        if constexpr (std::is_same_v<T, float>) {
+            _mm_storeu_ps(p, x);
+        } else if constexpr (std::is_same_v<T, double>) {
+            _mm_storeu_pd(p, x);
+        } else {
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(p), x);
+        }
+    }
+
+    static vec set1(T value)
+    {
+        if constexpr (std::is_same_v<T, float>) {
+            return _mm_set1_ps(value);
+        } else if constexpr (std::is_same_v<T, double>) {
+            return _mm_set1_pd(value);
+        } else if constexpr (sizeof(T) == 1) {
+            return _mm_set1_epi8(char(value));
+        } else if constexpr (sizeof(T) == 2) {
+            return _mm_set1_epi16(short(value));
+        } else if constexpr (sizeof(T) == 4) {
+            return _mm_set1_epi32(int(value));
+        } else {
+            return _mm_set1_epi64x((long long)(value));
+        }
+    }
+
+    static uint64_t eq(vec x, vec y)
+    {
+        if constexpr (std::is_same_v<T, float>) {
+            return unsigned(_mm_movemask_ps(_mm_cmpeq_ps(x, y)));
+        } else if constexpr (std::is_same_v<T, double>) {
+            return unsigned(_mm_movemask_pd(_mm_cmpeq_pd(x, y)));
+        } else if constexpr (sizeof(T) == 1) {
+            return unsigned(_mm_movemask_epi8(_mm_cmpeq_epi8(x, y)));
+        } else if constexpr (sizeof(T) == 2) {
+            return unsigned(_mm_movemask_epi8(_mm_cmpeq_epi16(x, y)));
+        } else if constexpr (sizeof(T) == 4) {
+            return unsigned(_mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(x, y))));
+        } else {
+            // both 32-bit halves equal
+            __m128i e = _mm_cmpeq_epi32(x, y);
+            e = _mm_and_si128(e, _mm_shuffle_epi32(e, _MM_SHUFFLE(2, 3, 0, 1)));
+            return unsigned(_mm_movemask_pd(_mm_castsi128_pd(e)));
+        }
+    }
+
+    static uint64_t unordered(vec x)
+    {
+        if constexpr (std::is_same_v<T, float>) {
+            return unsigned(_mm_movemask_ps(_mm_cmpunord_ps(x, x)));
+        } else if constexpr (std::is_same_v<T, double>) {
+            return unsigned(_mm_movemask_pd(_mm_cmpunord_pd(x, x)));
+        } else {
+            return 0;
+        }
+    }
+
+    // x > y lane-wise; unsigned lanes are compared as signed after flipping their sign bit
+    static __m128i gt(__m128i x, __m128i y)
+    {
+        if constexpr (std::is_unsigned_v<T>) {
+            const __m128i sign = set1(T(T(1) << (sizeof(T) * 8 - 1)));
+            x = _mm_xor_si128(x, sign);
+            y = _mm_xor_si128(y, sign);
+        }
+        if constexpr (sizeof(T) == 1) {
+            return _mm_cmpgt_epi8(x, y);
+        } else if constexpr (sizeof(T) == 2) {
+            return _mm_cmpgt_epi16(x, y);
+        } else {
+            return _mm_cmpgt_epi32(x, y);
+        }
+    }
+
+    // lanes of x where 'mask' is set, of y elsewhere
+    static __m128i select(__m128i mask, __m128i x, __m128i y)
+    {
+        return _mm_or_si128(_mm_and_si128(mask, x), _mm_andnot_si128(mask, y));
+    }
+
+    static vec min(vec x, vec y)
+    {
+        if constexpr (std::is_same_v<T, float>) {
+            return _mm_min_ps(x, y);
+        } else if constexpr (std::is_same_v<T, double>) {
+            return _mm_min_pd(x, y);
+        } else if constexpr (sizeof(T) == 1 && std::is_unsigned_v<T>) {
+            return _mm_min_epu8(x, y);
+        } else if constexpr (sizeof(T) == 2 && std::is_signed_v<T>) {
+            return _mm_min_epi16(x, y);
+        } else {
+            return select(gt(x, y), y, x);
+        }
+    }
+
+    static vec max(vec x, vec y)
+    {
+        if constexpr (std::is_same_v<T, float>) {
+            return _mm_max_ps(x, y);
+        } else if constexpr (std::is_same_v<T, double>) {
+            return _mm_max_pd(x, y);
+        } else if constexpr (sizeof(T) == 1 && std::is_unsigned_v<T>) {
+            return _mm_max_epu8(x, y);
+        } else if constexpr (sizeof(T) == 2 && std::is_signed_v<T>) {
+            return _mm_max_epi16(x, y);
+        } else {
+            return select(gt(x, y), x, y);
+        }
+    }
+
+    // SSE2 does not imply POPCNT, and __builtin_popcountll() would be a library call
+    static int popcount(uint64_t mask)
+    {
+        mask = mask - ((mask >> 1) & 0x5555555555555555ull);
+        mask = (mask & 0x3333333333333333ull) + ((mask >> 2) & 0x3333333333333333ull);
+        mask = (mask + (mask >> 4)) & 0x0F0F0F0F0F0F0F0Full;
+        return int((mask * 0x0101010101010101ull) >> 56);
+    }
+};
+
+template<typename T>
+struct __simd_ops_avx2 {
+    typedef std::conditional_t<std::is_same_v<T, float>, __m256,
+        std::conditional_t<std::is_same_v<T, double>, __m256d, __m256i>> vec;
+
+    static constexpr size_t lanes = 32 / sizeof(T);
+    static constexpr int mask_bits = sizeof(T) == 2 ? 2 : 1;
+    static constexpr bool has_minmax = true;
+
+    MINI_SIMD_TARGET_AVX2 static vec load(const T* p)
+    {
+        if constexpr (std::is_same_v<T, float>) {
+            return _mm256_loadu_ps(p);
+        } else if constexpr (std::is_same_v<T, double>) {
+            return _mm256_loadu_pd(p);
+        } else {
+            return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p));
+        }
+    }
+
+    MINI_SIMD_TARGET_AVX2 static void store(T* p, vec x)
+    {
+        if constexpr (std::is_same_v<T, float>) {
+            _mm256_storeu_ps(p, x);
+        } else if constexpr (std::is_same_v<T, double>) {
+            _mm256_storeu_pd(p, x);
+        } else {
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(p), x);
+        }
+    }
+
+    MINI_SIMD_TARGET_AVX2 static vec set1(T value)
+    {
+        if constexpr (std::is_same_v<T, float>) {
+            return _mm256_set1_ps(value);
+        } else if constexpr (std::is_same_v<T, double>) {
+            return _mm256_set1_pd(value);
+        } else if constexpr (sizeof(T) == 1) {
+            return _mm256_set1_epi8(char(value));
+        } else if constexpr (sizeof(T) == 2) {
+            return _mm256_set1_epi16(short(value));
+        } else if constexpr (sizeof(T) == 4) {
+            return _mm256_set1_epi32(int(value));
+        } else {
+            return _mm256_set1_epi64x((long long)(value));
+        }
+    }
+
+    MINI_SIMD_TARGET_AVX2 static uint64_t eq(vec x, vec y)
+    {
+        if constexpr (std::is_same_v<T, float>) {
+            return unsigned(_mm256_movemask_ps(_mm256_cmp_ps(x, y, _CMP_EQ_OQ)));
+        } else if constexpr (std::is_same_v<T, double>) {
+            return unsigned(_mm256_movemask_pd(_mm256_cmp_pd(x, y, _CMP_EQ_OQ)));
+        } else if constexpr (sizeof(T) == 1) {
+            return unsigned(_mm256_movemask_epi8(_mm256_cmpeq_epi8(x, y)));
+        } else if constexpr (sizeof(T) == 2) {
+            return unsigned(_mm256_movemask_epi8(_mm256_cmpeq_epi16(x, y)));
+        } else if constexpr (sizeof(T) == 4) {
+            return unsigned(_mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(x, y))));
+        } else {
+            return unsigned(_mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpeq_epi64(x, y))));
+        }
+    }
+
+    MINI_SIMD_TARGET_AVX2 static uint64_t unordered(vec x)
+    {
+        if constexpr (std::is_same_v<T, float>) {
+            return unsigned(_mm256_movemask_ps(_mm256_cmp_ps(x, x, _CMP_UNORD_Q)));
+        } else if constexpr (std::is_same_v<T, double>) {
+            return unsigned(_mm256_movemask_pd(_mm256_cmp_pd(x, x, _CMP_UNORD_Q)));
+        } else {
+            return 0;
+        }
+    }
+
+    // x > y for 64-bit lanes, the only width without a native min/max
+    MINI_SIMD_TARGET_AVX2 static __m256i gt64(__m256i x, __m256i y)
+    {
+        if constexpr (std::is_unsigned_v<T>) {
+            const __m256i sign = _mm256_set1_epi64x((long long)(1ull << 63));
+            x = _mm256_xor_si256(x, sign);
+            y = _mm256_xor_si256(y, sign);
+        }
+        return _mm256_cmpgt_epi64(x, y);
+    }
+
+    MINI_SIMD_TARGET_AVX2 static vec min(vec x, vec y)
+    {
+        if constexpr (std::is_same_v<T, float>) {
+            return _mm256_min_ps(x, y);
+        } else if constexpr (std::is_same_v<T, double>) {
+            return _mm256_min_pd(x, y);
+        } else if constexpr (sizeof(T) == 1) {
+            return std::is_signed_v<T> ? _mm256_min_epi8(x, y) : _mm256_min_epu8(x, y);
+        } else if constexpr (sizeof(T) == 2) {
+            return std::is_signed_v<T> ? _mm256_min_epi16(x, y) : _mm256_min_epu16(x, y);
+        } else if constexpr (sizeof(T) == 4) {
+            return std::is_signed_v<T> ? _mm256_min_epi32(x, y) : _mm256_min_epu32(x, y);
+        } else {
+            return _mm256_blendv_epi8(x, y, gt64(x, y));
+        }
+    }
+
+    MINI_SIMD_TARGET_AVX2 static vec max(vec x, vec y)
+    {
+        if constexpr (std::is_same_v<T, float>) {
+            return _mm256_max_ps(x, y);
+        } else if constexpr (std::is_same_v<T, double>) {
+            return _mm256_max_pd(x, y);
+        } else if constexpr (sizeof(T) == 1) {
+            return std::is_signed_v<T> ? _mm256_max_epi8(x, y) : _mm256_max_epu8(x, y);
+        } else if constexpr (sizeof(T) == 2) {
+            return std::is_signed_v<T> ? _mm256_max_epi16(x, y) : _mm256_max_epu16(x, y);
+        } else if constexpr (sizeof(T) == 4) {
+            return std::is_signed_v<T> ? _mm256_max_epi32(x, y) : _mm256_max_epu32(x, y);
+        } else {
+            return _mm256_blendv_epi8(y, x, gt64(x, y));
+        }
+    }
+
+    MINI_SIMD_TARGET_AVX2 static int popcount(uint64_t mask) { return __builtin_popcountll(mask); }
+};
+
+template<typename T>
+struct __simd_ops_avx512 {
+    typedef std::conditional_t<std::is_same_v<T, float>, __m512,
+        std::conditional_t<std::is_same_v<T, double>, __m512d, __m512i>> vec;
+
+    static constexpr size_t lanes = 64 / sizeof(T);
+    static constexpr int mask_bits = 1;
+    static constexpr bool has_minmax = true;
+
+    MINI_SIMD_TARGET_AVX512 static vec load(const T* p)
+    {
+        if constexpr (std::is_same_v<T, float>) {
+            return _mm512_loadu_ps(p);
+        } else if constexpr (std::is_same_v<T, double>) {
+            return _mm512_loadu_pd(p);
+        } else {
+            return _mm512_loadu_si512(p);
+        }
+    }
+
+    MINI_SIMD_TARGET_AVX512 static void store(T* p, vec x)
+    {
+        if constexpr (std::is_same_v<T, float>) {
+            _mm512_storeu_ps(p, x);
+        } else if constexpr (std::is_same_v<T, double>) {
+            _mm512_storeu_pd(p, x);
+        } else {
+            _mm512_storeu_si512(p, x);
+        }
+    }
+
+    MINI_SIMD_TARGET_AVX512 static vec set1(T value)
+    {
+        if constexpr (std::is_same_v<T, float>) {
+            return _mm512_set1_ps(value);
+        } else if constexpr (std::is_same_v<T, double>) {
+            return _mm512_set1_pd(value);
+        } else if constexpr (sizeof(T) == 1) {
+            return _mm512_set1_epi8(char(value));
+        } else if constexpr (sizeof(T) == 2) {
+            return _mm512_set1_epi16(short(value));
+        } else if constexpr (sizeof(T) == 4) {
+            return _mm512_set1_epi32(int(value));
+        } else {
+            return _mm512_set1_epi64((long long)(value));
+        }
+    }
+
+    MINI_SIMD_TARGET_AVX512 static uint64_t eq(vec x, vec y)
+    {
+        if constexpr (std::is_same_v<T, float>) {
+            return _mm512_cmp_ps_mask(x, y, _CMP_EQ_OQ);
+        } else if constexpr (std::is_same_v<T, double>) {
+            return _mm512_cmp_pd_mask(x, y, _CMP_EQ_OQ);
+        } else if constexpr (sizeof(T) == 1) {
+            return _mm512_cmpeq_epi8_mask(x, y);
+        } else if constexpr (sizeof(T) == 2) {
+            return _mm512_cmpeq_epi16_mask(x, y);
+        } else if constexpr (sizeof(T) == 4) {
+            return _mm512_cmpeq_epi32_mask(x, y);
+        } else {
+            return _mm512_cmpeq_epi64_mask(x, y);
+        }
+    }
+
+    MINI_SIMD_TARGET_AVX512 static uint64_t unordered(vec x)
+    {
+        if constexpr (std::is_same_v<T, float>) {
+            return _mm512_cmp_ps_mask(x, x, _CMP_UNORD_Q);
+        } else if constexpr (std::is_same_v<T, double>) {
+            return _mm512_cmp_pd_mask(x, x, _CMP_UNORD_Q);
+        } else {
+            return 0;
+        }
+    }
+
+    MINI_SIMD_TARGET_AVX512 static vec min(vec x, vec y)
+    {
+        if constexpr (std::is_same_v<T, float>) {
+            return _mm512_min_ps(x, y);
+        } else if constexpr (std::is_same_v<T, double>) {
+            return _mm512_min_pd(x, y);
+        } else if constexpr (sizeof(T) == 1) {
+            return std::is_signed_v<T> ? _mm512_min_epi8(x, y) : _mm512_min_epu8(x, y);
+        } else if constexpr (sizeof(T) == 2) {
+            return std::is_signed_v<T> ? _mm512_min_epi16(x, y) : _mm512_min_epu16(x, y);
+        } else if constexpr (sizeof(T) == 4) {
+            return std::is_signed_v<T> ? _mm512_min_epi32(x, y) : _mm512_min_epu32(x, y);
+        } else {
+            return std::is_signed_v<T> ? _mm512_min_epi64(x, y) : _mm512_min_epu64(x, y);
+        }
+    }
+
+    MINI_SIMD_TARGET_AVX512 static vec max(vec x, vec y)
+    {
+        if constexpr (std::is_same_v<T, float>) {
+            return _mm512_max_ps(x, y);
+        } else if constexpr (std::is_same_v<T, double>) {
+            return _mm512_max_pd(x, y);
+        } else if constexpr (sizeof(T) == 1) {
+            return std::is_signed_v<T> ? _mm512_max_epi8(x, y) : _mm512_max_epu8(x, y);
+        } else if constexpr (sizeof(T) == 2) {
+            return std::is_signed_v<T> ? _mm512_max_epi16(x, y) : _mm512_max_epu16(x, y);
+        } else if constexpr (sizeof(T) == 4) {
+            return std::is_signed_v<T> ? _mm512_max_epi32(x, y) : _mm512_max_epu32(x, y);
+        } else {
+            return std::is_signed_v<T> ? _mm512_max_epi64(x, y) : _mm512_max_epu64(x, y);
+        }
+    }
+
+    MINI_SIMD_TARGET_AVX512 static int popcount(uint64_t mask)
+    {
+        return __builtin_popcountll(mask);
+    }
+};
+
+//// kernels ////
+
+// Mask of eq() with every lane set
+template<typename Ops>
+inline constexpr uint64_t __simd_full_mask =
+    Ops::lanes * Ops::mask_bits == 64 ? ~uint64_t(0)
+                                      : (uint64_t(1) << (Ops::lanes * Ops::mask_bits)) - 1;
+
+// Index of the first element equal to 'value', n if none
+template<typename Ops, typename T>
+MINI_SIMD_INLINE size_t __simd_find_kernel(const T* p, size_t n, T value)
+{
+    const typename Ops::vec key = Ops::set1(value);
+    size_t i = 0;
+    for (; i + Ops::lanes <= n; i += Ops::lanes) {
+        const uint64_t mask = Ops::eq(Ops::load(p + i), key);
+        if (mask != 0) {
+            return i + size_t(__builtin_ctzll(mask)) / Ops::mask_bits;
+        }
+    }
+    while (i < n && !(p[i] == value)) {
+        ++i;
+    }
+    return i;
+}
+
+// Number of elements equal to 'value'
+template<typename Ops, typename T>
+MINI_SIMD_INLINE size_t __simd_count_kernel(const T* p, size_t n, T value)
+{
+    const typename Ops::vec key = Ops::set1(value);
+    size_t bits = 0;
+    size_t i = 0;
+    for (; i + Ops::lanes <= n; i += Ops::lanes) {
+        bits += size_t(Ops::popcount(Ops::eq(Ops::load(p + i), key)));
+    }
+    size_t count = bits / Ops::mask_bits;
+    for (; i < n; ++i) {
+        count += p[i] == value;
+    }
+    return count;
+}
+
+// Index of the first i with !(p[i] == q[i]), n if none
+template<typename Ops, typename T>
+MINI_SIMD_INLINE size_t __simd_mismatch_kernel(const T* p, const T* q, size_t n)
+{
+    size_t i = 0;
+    for (; i + Ops::lanes <= n; i += Ops::lanes) {
+        const uint64_t mask = ~Ops::eq(Ops::load(p + i), Ops::load(q + i)) & __simd_full_mask<Ops>;
+        if (mask != 0) {
+            return i + size_t(__builtin_ctzll(mask)) / Ops::mask_bits;
+        }
+    }
+    while (i < n && p[i] == q[i]) {
+        ++i;
+    }
+    return i;
+}
+
+// Smallest (or largest, if Max) element value of p[0, n), n >= Ops::lanes. Returns false if a
+// NaN is found: operator< does not order it, and only the scalar loop gives the answer
+// min_element() and max_element() are specified to return.
+template<typename Ops, bool Max, typename T>
+MINI_SIMD_INLINE bool __simd_extremum_kernel(const T* p, size_t n, T& result)
+{
+    typename Ops::vec acc = Ops::load(p);
+    uint64_t nan = Ops::unordered(acc);
+    size_t i = Ops::lanes;
+    for (; i + Ops::lanes <= n; i += Ops::lanes) {
+        const typename Ops::vec x = Ops::load(p + i);
+        nan |= Ops::unordered(x);
+        acc = Max ? Ops::max(acc, x) : Ops::min(acc, x);
+    }
+    if (nan != 0) {
+        return false;
+    }
+    T lane[Ops::lanes];
+    Ops::store(lane, acc);
+    T value = lane[0];
+    for (size_t j = 1; j < Ops::lanes; ++j) {
+        if (Max ? value < lane[j] : lane[j] < value) {
+            value = lane[j];
+        }
+    }
+    for (; i < n; ++i) {
+        if (!(p[i] == p[i])) {
+            return false;
+        }
+        if (Max ? value < p[i] : p[i] < value) {
+            value = p[i];
+        }
+    }
+    result = value;
+    return true;
+}
+
+//// entry points per instruction set ////
+
+template<typename T>
+MINI_SIMD_TARGET_AVX2 size_t __simd_find_avx2(const T* p, size_t n, T value)
+{
+    return __simd_find_kernel<__simd_ops_avx2<T>>(p, n, value);
+}
+
+template<typename T>
+MINI_SIMD_TARGET_AVX512 size_t __simd_find_avx512(const T* p, size_t n, T value)
+{
+    return __simd_find_kernel<__simd_ops_avx512<T>>(p, n, value);
+}
+
+template<typename T>
+MINI_SIMD_TARGET_AVX2 size_t __simd_count_avx2(const T* p, size_t n, T value)
+{
+    return __simd_count_kernel<__simd_ops_avx2<T>>(p, n, value);
+}
+
+template<typename T>
+MINI_SIMD_TARGET_AVX512 size_t __simd_count_avx512(const T* p, size_t n, T value)
+{
+    return __simd_count_kernel<__simd_ops_avx512<T>>(p, n, value);
+}
+
+template<typename T>
+MINI_SIMD_TARGET_AVX2 size_t __simd_mismatch_avx2(const T* p, const T* q, size_t n)
+{
+    return __simd_mismatch_kernel<__simd_ops_avx2<T>>(p, q, n);
+}
+
+template<typename T>
+MINI_SIMD_TARGET_AVX512 size_t __simd_mismatch_avx512(const T* p, const T* q, size_t n)
+{
+    return __simd_mismatch_kernel<__simd_ops_avx512<T>>(p, q, n);
+}
+
+template<bool Max, typename T>
+MINI_SIMD_TARGET_AVX2 bool __simd_extremum_avx2(const T* p, size_t n, T& result)
+{
+    return __simd_extremum_kernel<__simd_ops_avx2<T>, Max>(p, n, result);
+}
+
+template<bool Max, typename T>
+MINI_SIMD_TARGET_AVX512 bool __simd_extremum_avx512(const T* p, size_t n, T& result)
+{
+    return __simd_extremum_kernel<__simd_ops_avx512<T>, Max>(p, n, result);
+}
+
+#endif  // MINI_SIMD_X86
+
+//// dispatch ////
+
+/**
+ * @brief Index of the first element of p[0, n) equal to 'value', n if none.
+ *
+ * @param level Instruction set to use, at most __simd_cpu_level()
+ */
+template<typename T>
+size_t __simd_find(const T* p, size_t n, T value, __simd_level level = __simd_cpu_level())
+{
+    switch (level) {
+#if MINI_SIMD_X86
+    case __simd_avx512:
+        return __simd_find_avx512(p, n, value);
+    case __simd_avx2:
+        return __simd_find_avx2(p, n, value);
+    case __simd_sse2:
+        return __simd_find_kernel<__simd_ops_sse2<T>>(p, n, value);
+#endif
+    default:
+        size_t i = 0;
+        while (i < n && !(p[i] == value)) {
+            ++i;
+        }
+        return i;
+    }
+}
+
+// Number of elements of p[0, n) equal to 'value'
+template<typename T>
+size_t __simd_count(const T* p, size_t n, T value, __simd_level level = __simd_cpu_level())
+{
+    switch (level) {
+#if MINI_SIMD_X86
+    case __simd_avx512:
+        return __simd_count_avx512(p, n, value);
+    case __simd_avx2:
+        return __simd_count_avx2(p, n, value);
+    case __simd_sse2:
+        return __simd_count_kernel<__simd_ops_sse2<T>>(p, n, value);
+#endif
+    default:
+        size_t count = 0;
+        for (size_t i = 0; i < n; ++i) {
+            count += p[i] == value;
+        }
+        return count;
+    }
+}
+
+// Index of the first i with !(p[i] == q[i]), n if none
+template<typename T>
+size_t __simd_mismatch(const T* p, const T* q, size_t n, __simd_level level = __simd_cpu_level())
+{
+    switch (level) {
+#if MINI_SIMD_X86
+    case __simd_avx512:
+        return __simd_mismatch_avx512(p, q, n);
+    case __simd_avx2:
+        return __simd_mismatch_avx2(p, q, n);
+    case __simd_sse2:
+        return __simd_mismatch_kernel<__simd_ops_sse2<T>>(p, q, n);
+#endif
+    default:
+        size_t i = 0;
+        while (i < n && p[i] == q[i]) {
+            ++i;
+        }
+        return i;
+    }
+}
+
+/**
+ * @brief Smallest (or largest, if Max) element value of p[0, n) into 'result'.
+ *
+ * @return bool false if the value is left to the caller's scalar loop: ranges shorter than a
+ *         vector, instruction sets without the needed min/max, and ranges holding a NaN
+ */
+template<bool Max, typename T>
+bool __simd_extremum(const T* p, size_t n, T& result, __simd_level level = __simd_cpu_level())
+{
+    switch (level) {
+#if MINI_SIMD_X86
+    case __simd_avx512:
+        return n >= __simd_ops_avx512<T>::lanes && __simd_extremum_avx512<Max>(p, n, result);
+    case __simd_avx2:
+        return n >= __simd_ops_avx2<T>::lanes && __simd_extremum_avx2<Max>(p, n, result);
+    case __simd_sse2:
+        if constexpr (__simd_ops_sse2<T>::has_minmax) {
+            return n >= __simd_ops_sse2<T>::lanes
+                   && __simd_extremum_kernel<__simd_ops_sse2<T>, Max>(p, n, result);
+        }
+        return false;
+#endif
+    default:
+        return false;
+    }
+}
+
+}  // namespace mini::algo
+
+#if MINI_SIMD_X86
+#undef MINI_SIMD_INLINE
+#undef MINI_SIMD_TARGET_AVX2
+#undef MINI_SIMD_TARGET_AVX512
+#pragma GCC diagnostic pop
+#endif
+
+#endif
@@ -0,0 +1,522 @@
+#ifndef MINI_ALGORITHM_SORT_H
+#define MINI_ALGORITHM_SORT_H
+
+#include "mini_stl/algorithm/mini_algorithm_base.h"
+#include "mini_stl/algorithm/mini_algorithm_heap.h"
+#include "mini_stl/base/mini_base_macro.h"
+#include "mini_stl/functional/mini_functional_relational.h"
+#include "mini_stl/iterator/mini_iterator_base.h"
+#include "mini_stl/memory/mini_memory_construct.h"
+#include "mini_stl/memory/mini_memory_uninitialized.h"
+
+#include <cstdint>
+#include <new>
+#include <utility>
+
+namespace mini::algo {
+
+// Partitions of at most this many elements are left to insertion sort
+inline constexpr ptrdiff_t __sort_threshold = 16;
+
+// floor(log2(n)) for n > 0
+template<typename Size>
+inline Size __lg(Size n)
+{
+    Size k = 0;
+    for (; n > 1; n >>= 1) {
+        ++k;
+    }
+    return k;
+}
+
+//// insertion sort ////
+
+// Insert *last into the sorted range before it. Unguarded: an element not greater than *last
+// must exist before it, the scan stops there without checking the range bound.
+template<typename RandomAccessIterator, typename Compare>
+void __unguarded_linear_insert(RandomAccessIterator last, Compare comp)
+{
+    typename iter::iterator_traits<RandomAccessIterator>::value_type value = std::move(*last);
+    RandomAccessIterator next = last;
+    --next;
+    while (comp(value, *next)) {
+        *last = std::move(*next);
+        last = next;
+        --next;
+    }
+    *last = std::move(value);
+}
+
+// Stable: an element never moves in front of an equal one
+template<typename RandomAccessIterator, typename Compare>
+void __insertion_sort(RandomAccessIterator first, RandomAccessIterator last, Compare comp)
+{
+    if (first == last) {
+        return;
+    }
+    for (RandomAccessIterator i = first + 1; i != last; ++i) {
+        if (comp(*i, *first)) {
+            // new minimum: shift the whole sorted prefix
+            typename iter::iterator_traits<RandomAccessIterator>::value_type value = std::move(*i);
+            mini::algo::move_backward(first, i, i + 1);
+            *first = std::move(value);
+        } else {
+            mini::algo::__unguarded_linear_insert(i, comp);
+        }
+    }
+}
+
+template<typename RandomAccessIterator, typename Compare>
+void __unguarded_insertion_sort(RandomAccessIterator first, RandomAccessIterator last, Compare comp)
+{
+    for (RandomAccessIterator i = first; i != last; ++i) {
+        mini::algo::__unguarded_linear_insert(i, comp);
+    }
+}
+
+// After __introsort_loop() the range is a sequence of unsorted partitions, each no greater than
+// the next, and the first one holds the minimum. Only the first __sort_threshold elements need
+// the bound check.
+template<typename RandomAccessIterator, typename Compare>
+void __final_insertion_sort(RandomAccessIterator first, RandomAccessIterator last, Compare comp)
+{
+    if (last - first > __sort_threshold) {
+        mini::algo::__insertion_sort(first, first + __sort_threshold, comp);
+        mini::algo::__unguarded_insertion_sort(first + __sort_threshold, last, comp);
+    } else {
+        mini::algo::__insertion_sort(first, last, comp);
+    }
+}
+
+//// partitioning ////
+
+// Swap the median of *a, *b and *c into *result
+template<typename RandomAccessIterator, typename Compare>
+void __move_median_to_first(RandomAccessIterator result, RandomAccessIterator a,
+    RandomAccessIterator b, RandomAccessIterator c, Compare comp)
+{
+    if (comp(*a, *b)) {
+        if (comp(*b, *c)) {
+            mini::algo::iter_swap(result, b);
+        } else if (comp(*a, *c)) {
+            mini::algo::iter_swap(result, c);
+        } else {
+            mini::algo::iter_swap(result, a);
+        }
+    } else if (comp(*a, *c)) {
+        mini::algo::iter_swap(result, a);
+    } else if (comp(*b, *c)) {
+        mini::algo::iter_swap(result, c);
+    } else {
+        mini::algo::iter_swap(result, b);
+    }
+}
+
+// Hoare partition of [first, last) around *pivot. Unguarded: elements not less and not greater
+// than the pivot must exist at both ends, the scans stop on them.
+template<typename RandomAccessIterator, typename Compare>
+RandomAccessIterator __unguarded_partition(RandomAccessIterator first, RandomAccessIterator last,
+    RandomAccessIterator pivot, Compare comp)
+{
+    for (;;) {
+        while (comp(*first, *pivot)) {
+            ++first;
+        }
+        --last;
+        while (comp(*pivot, *last)) {
+            --last;
+        }
+        if (!(first < last)) {
+            return first;
+        }
+        mini::algo::iter_swap(first, last);
+        ++first;
+    }
+}
+
+// Median-of-3 pivot moved to *first, which makes both scans of the partition safe: the other
+// two candidates end up on either side of it.
+template<typename RandomAccessIterator, typename Compare>
+inline RandomAccessIterator __unguarded_partition_pivot(
+    RandomAccessIterator first, RandomAccessIterator last, Compare comp)
+{
+    RandomAccessIterator mid = first + (last - first) / 2;
+    mini::algo::__move_median_to_first(first, first + 1, mid, last - 1, comp);
+    return mini::algo::__unguarded_partition(first + 1, last, first, comp);
+}
+
+//// sort() ////
+
+template<typename RandomAccessIterator, typename Size, typename Compare>
+void __introsort_loop(
+    RandomAccessIterator first, RandomAccessIterator last, Size depth_limit, Compare comp)
+{
+    while (last - first > __sort_threshold) {
+        if (depth_limit == 0) {
+            // too many bad pivots: heapsort what is left, O(n log n) in any case
+            mini::algo::make_heap(first, last, comp);
+            mini::algo::sort_heap(first, last, comp);
+            return;
+        }
+        --depth_limit;
+        RandomAccessIterator cut = mini::algo::__unguarded_partition_pivot(first, last, comp);
+        // recurse on the right part, loop on the left one
+        mini::algo::__introsort_loop(cut, last, depth_limit, comp);
+        last = cut;
+    }
+}
+
+/**
+ * @brief Sort [first, last) in ascending order of 'comp'. Not stable.
+ *
+ * @attention Introsort: median-of-3 quicksort, switching to heapsort past 2 * log2(n) levels of
+ *            recursion, and leaving partitions of 16 elements or fewer to one final insertion
+ *            sort pass. O(n log n) comparisons in the worst case.
+ */
+template<typename RandomAccessIterator, typename Compare>
+void sort(RandomAccessIterator first, RandomAccessIterator last, Compare comp)
+{
+    if (last - first > 1) {
+        mini::algo::__introsort_loop(first, last, mini::algo::__lg(last - first) * 2, comp);
+        mini::algo::__final_insertion_sort(first, last, comp);
+    }
+}
+
+template<typename RandomAccessIterator>
+void sort(RandomAccessIterator first, RandomAccessIterator last)
+{
+    mini::algo::sort(first, last, func::less<>());
+}
+
+//// partial_sort() ////
+
+// Gather the (middle - first) smallest elements in a heap over [first, middle)
+template<typename RandomAccessIterator, typename Compare>
+void __heap_select(RandomAccessIterator first, RandomAccessIterator middle,
+    RandomAccessIterator last, Compare comp)
+{
+    typedef typename iter::iterator_traits<RandomAccessIterator>::value_type T;
+    mini::algo::make_heap(first, middle, comp);
+    for (RandomAccessIterator i = middle; i < last; ++i) {
+        if (comp(*i, *first)) {
+            // replace the largest of the heap, which goes to *i
+            mini::algo::__pop_heap(
+                first, middle, i, T(std::move(*i)), iter::distance_type(first), comp);
+        }
+    }
+}
+
+/**
+ * @brief Place the (middle - first) smallest elements, sorted, in [first, middle). The order of
+ *        the other elements is unspecified.
+ *
+ * @attention Heap selection then heapsort: O((last - first) log(middle - first)).
+ */
+template<typename RandomAccessIterator, typename Compare>
+void partial_sort(RandomAccessIterator first, RandomAccessIterator middle,
+    RandomAccessIterator last, Compare comp)
+{
+    if (first == middle) {
+        return;
+    }
+    mini::algo::__heap_select(first, middle, last, comp);
+    mini::algo::sort_heap(first, middle, comp);
+}
+
+template<typename RandomAccessIterator>
+void partial_sort(
+    RandomAccessIterator first, RandomAccessIterator middle, RandomAccessIterator last)
+{
+    mini::algo::partial_sort(first, middle, last, func::less<>());
+}
+
+//// nth_element() ////
+
+template<typename RandomAccessIterator, typename Size, typename Compare>
+void __introselect(RandomAccessIterator first, RandomAccessIterator nth,
+    RandomAccessIterator last, Size depth_limit, Compare comp)
+{
+    while (last - first > 3) {
+        if (depth_limit == 0) {
+            // the top of a heap of the smallest (nth - first + 1) elements is the nth element
+            mini::algo::__heap_select(first, nth + 1, last, comp);
+            mini::algo::iter_swap(first, nth);
+            return;
+        }
+        --depth_limit;
+        RandomAccessIterator cut = mini::algo::__unguarded_partition_pivot(first, last, comp);
+        if (cut <= nth) {
+            first = cut;
+        } else {
+            last = cut;
+        }
+    }
+    mini::algo::__insertion_sort(first, last, comp);
+}
+
+/**
+ * @brief Put in *nth the element that would be there if [first, last) was sorted, with no
+ *        greater element before it and no smaller one after it.
+ *
+ * @attention Introselect: quickselect with median-of-3 pivots, average O(n), switching to heap
+ *            selection past 2 * log2(n) partitions so that the worst case is O(n log n).
+ */
+template<typename RandomAccessIterator, typename Compare>
+void nth_element(RandomAccessIterator first, RandomAccessIterator nth, RandomAccessIterator last,
+    Compare comp)
+{
+    if (first == last || nth == last) {
+        return;
+    }
+    mini::algo::__introselect(first, nth, last, mini::algo::__lg(last - first) * 2, comp);
+}
+
+template<typename RandomAccessIterator>
+void nth_element(RandomAccessIterator first, RandomAccessIterator nth, RandomAccessIterator last)
+{
+    mini::algo::nth_element(first, nth, last, func::less<>());
+}
+
+//// stable_sort() ////
+
+/**
+ * @brief Uninitialized storage for up to 'requested' objects of type T, as many as the heap can
+ *        provide: the request is halved until an allocation succeeds, possibly down to none.
+ */
+template<typename T>
+class __temporary_buffer {
+    MINI_DISALLOW_COPY_AND_MOVE(__temporary_buffer);
+
+    static constexpr bool over_aligned = alignof(T) > __STDCPP_DEFAULT_NEW_ALIGNMENT__;
+
+public:
+    explicit __temporary_buffer(ptrdiff_t requested)
+        : buf_(0)
+        , size_(0)
+    {
+        if (requested > PTRDIFF_MAX / ptrdiff_t(sizeof(T))) {
+            requested = PTRDIFF_MAX / ptrdiff_t(sizeof(T));
+        }
+        for (; requested > 0; requested /= 2) {
+            if constexpr (over_aligned) {
+                buf_ = static_cast<T*>(::operator new(
+                    requested * sizeof(T), std::align_val_t(alignof(T)), std::nothrow));
+            } else {
+                buf_ = static_cast<T*>(::operator new(requested * sizeof(T), std::nothrow));
+            }
+            if (buf_) {
+                size_ = requested;
+                break;
+            }
+        }
+    }
+
+    ~__temporary_buffer()
+    {
+        if constexpr (over_aligned) {
+            ::operator delete(buf_, std::align_val_t(alignof(T)));
+        } else {
+            ::operator delete(buf_);
+        }
+    }
+
+    T* begin() const { return buf_; }
+
+    ptrdiff_t size() const { return size_; }
+
+protected:
+    T* buf_;
+    ptrdiff_t size_;
+};
+
+// Merge the sorted ranges [first, middle) and [middle, last) in place. The left range is moved
+// to 'buffer' (room for at least middle - first elements) and merged back from the front: the
+// output never catches up with the unread part of the right range. Ties are taken from the left
+// range, which keeps the merge stable.
+template<typename RandomAccessIterator, typename T, typename Compare>
+void __merge_with_buffer(RandomAccessIterator first, RandomAccessIterator middle,
+    RandomAccessIterator last, T* buffer, Compare comp)
+{
+    T* buffer_end = mem::uninitialized_move(first, middle, buffer);
+    T* cur = buffer;
+    try {
+        while (cur != buffer_end && middle != last) {
+            if (comp(*middle, *cur)) {
+                *first = std::move(*middle);
+                ++middle;
+            } else {
+                *first = std::move(*cur);
+                ++cur;
+            }
+            ++first;
+        }
+    } catch (...) {
+        // put the buffered elements back, so that the range holds every element once
+        mini::algo::move(cur, buffer_end, first);
+        mem::destroy(buffer, buffer_end);
+        throw;
+    }
+    // what is left of the right range is already in place
+    mini::algo::move(cur, buffer_end, first);
+    mem::destroy(buffer, buffer_end);
+}
+
+template<typename RandomAccessIterator, typename T, typename Compare>
+void __merge_sort_with_buffer(
+    RandomAccessIterator first, RandomAccessIterator last, T* buffer, Compare comp)
+{
+    if (last - first <= __sort_threshold) {
+        mini::algo::__insertion_sort(first, last, comp);
+        return;
+    }
+    RandomAccessIterator middle = first + (last - first) / 2;
+    mini::algo::__merge_sort_with_buffer(first, middle, buffer, comp);
+    mini::algo::__merge_sort_with_buffer(middle, last, buffer, comp);
+    if (comp(*middle, *(middle - 1))) {  // else the halves are already in order
+        mini::algo::__merge_with_buffer(first, middle, last, buffer, comp);
+    }
+}
+
+// First position in sorted [first, last) where 'value' could be inserted, before equal elements
+template<typename RandomAccessIterator, typename T, typename Compare>
+RandomAccessIterator __lower_bound(
+    RandomAccessIterator first, RandomAccessIterator last, const T& value, Compare comp)
+{
+    typename iter::iterator_traits<RandomAccessIterator>::difference_type len = last - first;
+    while (len > 0) {
+        const auto half = len / 2;
+        RandomAccessIterator mid = first + half;
+        if (comp(*mid, value)) {
+            first = mid + 1;
+            len -= half + 1;
+        } else {
+            len = half;
+        }
+    }
+    return first;
+}
+
+// Last position in sorted [first, last) where 'value' could be inserted, after equal elements
+template<typename RandomAccessIterator, typename T, typename Compare>
+RandomAccessIterator __upper_bound(
+    RandomAccessIterator first, RandomAccessIterator last, const T& value, Compare comp)
+{
+    typename iter::iterator_traits<RandomAccessIterator>::difference_type len = last - first;
+    while (len > 0) {
+        const auto half = len / 2;
+        RandomAccessIterator mid = first + half;
+        if (comp(value, *mid)) {
+            len = half;
+        } else {
+            first = mid + 1;
+            len -= half + 1;
+        }
+    }
+    return first;
+}
+
+template<typename RandomAccessIterator>
+void __reverse(RandomAccessIterator first, RandomAccessIterator last)
+{
+    if (first == last) {
+        return;
+    }
+    for (--last; first < last; ++first, --last) {
+        mini::algo::iter_swap(first, last);
+    }
+}
+
+// Exchange [first, middle) and [middle, last), return the new position of *first
+template<typename RandomAccessIterator>
+RandomAccessIterator __rotate(
+    RandomAccessIterator first, RandomAccessIterator middle, RandomAccessIterator last)
+{
+    mini::algo::__reverse(first, middle);
+    mini::algo::__reverse(middle, last);
+    mini::algo::__reverse(first, last);
+    return first + (last - middle);
+}
+
+// Stable merge without extra memory: split the longer range in halves, find where its middle
+// element falls in the other range, rotate the two inner pieces and merge both sides again.
+template<typename RandomAccessIterator, typename Distance, typename Compare>
+void __merge_without_buffer(RandomAccessIterator first, RandomAccessIterator middle,
+    RandomAccessIterator last, Distance len1, Distance len2, Compare comp)
+{
+    if (len1 == 0 || len2 == 0) {
+        return;
+    }
+    if (len1 + len2 == 2) {
+        if (comp(*middle, *first)) {
+            mini::algo::iter_swap(first, middle);
+        }
+        return;
+    }
+    RandomAccessIterator first_cut = first;
+    RandomAccessIterator second_cut = middle;
+    Distance len11 = 0;
+    Distance len22 = 0;
+    if (len1 > len2) {
+        len11 = len1 / 2;
+        first_cut = first + len11;
+        second_cut = mini::algo::__lower_bound(middle, last, *first_cut, comp);
+        len22 = second_cut - middle;
+    } else {
+        len22 = len2 / 2;
+        second_cut = middle + len22;
+        first_cut = mini::algo::__upper_bound(first, middle, *second_cut, comp);
+        len11 = first_cut - first;
+    }
+    RandomAccessIterator new_middle = mini::algo::__rotate(first_cut, middle, second_cut);
+    mini::algo::__merge_without_buffer(first, first_cut, new_middle, len11, len22, comp);
+    mini::algo::__merge_without_buffer(
+        new_middle, second_cut, last, len1 - len11, len2 - len22, comp);
+}
+
+template<typename RandomAccessIterator, typename Compare>
+void __inplace_stable_sort(RandomAccessIterator first, RandomAccessIterator last, Compare comp)
+{
+    if (last - first <= __sort_threshold) {
+        mini::algo::__insertion_sort(first, last, comp);
+        return;
+    }
+    RandomAccessIterator middle = first + (last - first) / 2;
+    mini::algo::__inplace_stable_sort(first, middle, comp);
+    mini::algo::__inplace_stable_sort(middle, last, comp);
+    mini::algo::__merge_without_buffer(first, middle, last, middle - first, last - middle, comp);
+}
+
+/**
+ * @brief Sort [first, last) in ascending order of 'comp', keeping the order of equal elements.
+ *
+ * @attention Merge sort over insertion-sorted runs of 16 elements, merging through a temporary
+ *            buffer of n / 2 elements: O(n log n). Halves already in order are not merged.
+ * @attention If the buffer cannot be allocated, merges are done in place by rotations:
+ *            O(n log^2 n).
+ */
+template<typename RandomAccessIterator, typename Compare>
+void stable_sort(RandomAccessIterator first, RandomAccessIterator last, Compare comp)
+{
+    typedef typename iter::iterator_traits<RandomAccessIterator>::value_type T;
+    const ptrdiff_t len = last - first;
+    if (len <= __sort_threshold) {
+        mini::algo::__insertion_sort(first, last, comp);
+        return;
+    }
+    __temporary_buffer<T> buffer((len + 1) / 2);
+    if (buffer.size() == (len + 1) / 2) {
+        mini::algo::__merge_sort_with_buffer(first, last, buffer.begin(), comp);
+    } else {
+        mini::algo::__inplace_stable_sort(first, last, comp);
+    }
+}
+
+template<typename RandomAccessIterator>
+void stable_sort(RandomAccessIterator first, RandomAccessIterator last)
+{
+    mini::algo::stable_sort(first, last, func::less<>());
+}
+
+}  // namespace mini::algo
+
+#endif
@@ -7,148 +7,47 @@ general type using 'type_traits'. For example, we can determine if a type has no
 non-trivial copy ctor...
 */
 
+#include <type_traits>
+
 namespace mini::type_traits {
 
 // We need a class type to represent 'true' and 'false'
 struct __true_type {};  // no member, no overhead
 struct __false_type {};
 
-// Primary template
-// Some compiler has ability to auto-generate specialized template for all types
-template<typename type>
-struct __type_traits {
-    typedef __true_type this_dummy_member_must_be_first;
-    typedef __false_type has_trivial_default_constructor;
-    typedef __false_type has_trivial_copy_constructor;
-    typedef __false_type has_trivial_assignment_operator;
-    typedef __false_type has_trivial_destructor;
-    typedef __false_type is_POD_type;
-};
-
-/*
-The followings are specialized version of type_traits for all scalar types.
-Necessary for compiliers that do not support auto-generation. All these scalar
-types will use the fastest way (e.g. memcpy) to do copy and assignment operations.
-*/
-
-// Partial specialization for primitive pointer
-// also considered as a scalar type
-template<typename T>
-struct __type_traits<T*> {
-    typedef __true_type has_trivial_default_constructor;
-    typedef __true_type has_trivial_copy_constructor;
-    typedef __true_type has_trivial_assignment_operator;
-    typedef __true_type has_trivial_destructor;
-    typedef __true_type is_POD_type;
-};
-
-// Explicit specialization
-template<>
-struct __type_traits<char> {
-    typedef __true_type has_trivial_default_constructor;
-    typedef __true_type has_trivial_copy_constructor;
-    typedef __true_type has_trivial_assignment_operator;
-    typedef __true_type has_trivial_destructor;
-    typedef __true_type is_POD_type;
+// Convert a compile-time boolean into __true_type/__false_type
+template<bool value>
+struct __bool_type {
+    typedef __true_type type;
 };
 
 template<>
-struct __type_traits<signed char> {
-    typedef __true_type has_trivial_default_constructor;
-    typedef __true_type has_trivial_copy_constructor;
-    typedef __true_type has_trivial_assignment_operator;
-    typedef __true_type has_trivial_destructor;
-    typedef __true_type is_POD_type;
+struct __bool_type<false> {
+    typedef __false_type type;
 };
 
-template<>
-struct __type_traits<unsigned char> {
-    typedef __true_type has_trivial_default_constructor;
-    typedef __true_type has_trivial_copy_constructor;
-    typedef __true_type has_trivial_assignment_operator;
-    typedef __true_type has_trivial_destructor;
-    typedef __true_type is_POD_type;
-};
-
-template<>
-struct __type_traits<short> {
-    typedef __true_type has_trivial_default_constructor;
-    typedef __true_type has_trivial_copy_constructor;
-    typedef __true_type has_trivial_assignment_operator;
-    typedef __true_type has_trivial_destructor;
-    typedef __true_type is_POD_type;
-};
-
-template<>
-struct __type_traits<unsigned short> {
-    typedef __true_type has_trivial_default_constructor;
-    typedef __true_type has_trivial_copy_constructor;
-    typedef __true_type has_trivial_assignment_operator;
-    typedef __true_type has_trivial_destructor;
-    typedef __true_type is_POD_type;
-};
-
-template<>
-struct __type_traits<int> {
-    typedef __true_type has_trivial_default_constructor;
-    typedef __true_type has_trivial_copy_constructor;
-    typedef __true_type has_trivial_assignment_operator;
-    typedef __true_type has_trivial_destructor;
-    typedef __true_type is_POD_type;
-};
-
-template<>
-struct __type_traits<unsigned int> {
-    typedef __true_type has_trivial_default_constructor;
-    typedef __true_type has_trivial_copy_constructor;
-    typedef __true_type has_trivial_assignment_operator;
-    typedef __true_type has_trivial_destructor;
-    typedef __true_type is_POD_type;
-};
-
-template<>
-struct __type_traits<long> {
-    typedef __true_type has_trivial_default_constructor;
-    typedef __true_type has_trivial_copy_constructor;
-    typedef __true_type has_trivial_assignment_operator;
-    typedef __true_type has_trivial_destructor;
-    typedef __true_type is_POD_type;
-};
-
-template<>
-struct __type_traits<unsigned long> {
-    typedef __true_type has_trivial_default_constructor;
-    typedef __true_type has_trivial_copy_constructor;
-    typedef __true_type has_trivial_assignment_operator;
-    typedef __true_type has_trivial_destructor;
-    typedef __true_type is_POD_type;
-};
-
-template<>
-struct __type_traits<float> {
-    typedef __true_type has_trivial_default_constructor;
-    typedef __true_type has_trivial_copy_constructor;
-    typedef __true_type has_trivial_assignment_operator;
-    typedef __true_type has_trivial_destructor;
-    typedef __true_type is_POD_type;
-};
-
-template<>
-struct __type_traits<double> {
-    typedef __true_type has_trivial_default_constructor;
-    typedef __true_type has_trivial_copy_constructor;
-    typedef __true_type has_trivial_assignment_operator;
-    typedef __true_type has_trivial_destructor;
-    typedef __true_type is_POD_type;
-};
-
-template<>
-struct __type_traits<long double> {
-    typedef __true_type has_trivial_default_constructor;
-    typedef __true_type has_trivial_copy_constructor;
-    typedef __true_type has_trivial_assignment_operator;
-    typedef __true_type has_trivial_destructor;
-    typedef __true_type is_POD_type;
+/*
+Primary template. The properties are queried from the compiler through the standard
+'is_trivially_*' traits, so every eligible type, including user-defined POD structs, gets
+the fast paths (e.g. memmove in copy(), no-op in destroy()) without a hand-written
+specialization. Scalar types and pointers are covered as well.
+A type can still be specialized explicitly to override the deduced properties.
+*/
+template<typename type>
+struct __type_traits {
+    typedef __true_type this_dummy_member_must_be_first;
+    typedef typename __bool_type<std::is_trivially_default_constructible<type>::value>::type
+        has_trivial_default_constructor;
+    typedef typename __bool_type<std::is_trivially_copy_constructible<type>::value>::type
+        has_trivial_copy_constructor;
+    typedef typename __bool_type<std::is_trivially_copy_assignable<type>::value>::type
+        has_trivial_assignment_operator;
+    typedef typename __bool_type<std::is_trivially_destructible<type>::value>::type
+        has_trivial_destructor;
+    typedef typename __bool_type<std::is_trivial<type>::value
+        && std::is_standard_layout<type>::value>::type is_POD_type;
+    // integers and floating point values: eligible for the vectorized scans of algorithms
+    typedef typename __bool_type<std::is_arithmetic<type>::value>::type is_arithmetic_type;
 };
 
 }  // namespace mini::type_traits
@@ -0,0 +1,390 @@
+#ifndef MINI_CONTAINER_ADAPTER_INDEXED_PRIORITY_QUEUE_H
+#define MINI_CONTAINER_ADAPTER_INDEXED_PRIORITY_QUEUE_H
+
+#include "mini_stl/memory/mini_memory.h"
+
+#include <cstddef>
+#include <functional>
+#include <utility>
+
+namespace mini::ctnr {
+
+/**
+ * @brief Min-queue whose elements keep a stable handle, through which they can be re-ranked or
+ *        erased in O(log n): decrease_key() instead of pushing a duplicate, as Dijkstra's
+ *        algorithm or a timer queue would otherwise do.
+ *
+ * @attention Unlike priority_queue, top() is the smallest element by 'Compare' (comp(x, top) is
+ *            false for every x), so that decrease_key() moves an element toward the top.
+ * @attention Layout: a 'Arity'-ary heap of {value, handle} nodes in one array, so that
+ *            comparisons read contiguous memory, plus a position map from handle to heap index,
+ *            updated whenever a node moves. No allocation per element: both arrays grow
+ *            geometrically, and the handles of popped or erased elements are recycled through
+ *            a free list threaded in the position map.
+ * @attention A handle is valid from the push() that returns it until its element is popped or
+ *            erased. It may then be returned again by a later push().
+ * @tparam T value type
+ * @tparam Compare strict weak ordering, top() is the smallest element
+ * @tparam Arity number of children per heap node
+ * @tparam Allocator 1st level allocator or sub-allocator
+ */
+template<typename T, typename Compare = std::less<T>, size_t Arity = 4,
+    typename Allocator = mem::alloc>
+class indexed_priority_queue {
+    static_assert(Arity >= 2, "a heap node has at least two children");
+
+public:  // public typedefs
+    typedef T value_type;
+    typedef const value_type& reference;
+    typedef const value_type& const_reference;
+    typedef size_t size_type;
+    typedef size_t handle_type;
+    typedef Compare value_compare;
+
+protected:  // internal typedefs
+    typedef indexed_priority_queue<T, Compare, Arity, Allocator> self;
+
+    struct node {
+        value_type value;
+        handle_type handle;
+    };
+
+    typedef mem::simple_alloc<node, Allocator> node_allocator;
+    typedef mem::simple_alloc<size_type, Allocator> position_allocator;
+
+    // set in the position map entry of a free handle, whose other bits hold the next free one
+    static constexpr size_type free_bit = ~(~size_type(0) >> 1);
+    static constexpr size_type no_handle = ~free_bit;
+
+public:
+    explicit indexed_priority_queue(const Compare& comp = Compare())
+        : heap_(0)
+        , pos_(0)
+        , size_(0)
+        , handles_(0)
+        , capacity_(0)
+        , free_(no_handle)
+        , comp_(comp)
+    {}
+
+    indexed_priority_queue(const self& other)
+        : indexed_priority_queue(other.comp_)
+    {
+        if (other.handles_ == 0) {
+            return;
+        }
+        size_type* pos = position_allocator::allocate(other.handles_);
+        node* heap;
+        try {
+            heap = node_allocator::allocate(other.handles_);
+        } catch (...) {
+            position_allocator::deallocate(pos, other.handles_);
+            throw;
+        }
+        try {
+            mem::uninitialized_copy(other.heap_, other.heap_ + other.size_, heap);
+        } catch (...) {
+            node_allocator::deallocate(heap, other.handles_);
+            position_allocator::deallocate(pos, other.handles_);
+            throw;
+        }
+        mem::uninitialized_copy(other.pos_, other.pos_ + other.handles_, pos);
+        heap_ = heap;
+        pos_ = pos;
+        size_ = other.size_;
+        handles_ = other.handles_;
+        capacity_ = other.handles_;
+        free_ = other.free_;
+    }
+
+    indexed_priority_queue(self&& other) noexcept
+        : indexed_priority_queue(other.comp_)
+    {
+        swap(other);
+    }
+
+    self& operator=(self other)
+    {
+        swap(other);
+        return *this;
+    }
+
+    ~indexed_priority_queue()
+    {
+        if (heap_) {
+            mem::destroy(heap_, heap_ + size_);
+            node_allocator::deallocate(heap_, capacity_);
+            position_allocator::deallocate(pos_, capacity_);
+        }
+    }
+
+public:
+    // Capacity
+
+    bool empty() const { return size_ == 0; }
+
+    size_type size() const { return size_; }
+
+    /**
+     * @brief Make room for 'n' elements without reallocation.
+     */
+    void reserve(size_type n)
+    {
+        if (n > capacity_) {
+            reallocate(n);
+        }
+    }
+
+    // Element access
+
+    const_reference top() const { return heap_[0].value; }
+
+    handle_type top_handle() const { return heap_[0].handle; }
+
+    /**
+     * @brief Whether 'h' is the handle of an element in the queue
+     */
+    bool contains(handle_type h) const { return h < handles_ && !(pos_[h] & free_bit); }
+
+    /**
+     * @brief Value of the element of handle 'h'
+     */
+    const_reference operator[](handle_type h) const { return heap_[pos_[h]].value; }
+
+    // Modifiers
+
+    /**
+     * @brief Insert 'value', O(log n).
+     * @return Handle of the new element
+     */
+    handle_type push(const value_type& value) { return emplace(value); }
+
+    handle_type push(value_type&& value) { return emplace(std::move(value)); }
+
+    template<typename... Args>
+    handle_type emplace(Args&&... args)
+    {
+        if (size_ == capacity_) {
+            // 'args' may refer to an element: build the value before the storage moves
+            value_type value(std::forward<Args>(args)...);
+            reallocate(capacity_ != 0 ? 2 * capacity_ : 8);
+            return insert(std::move(value));
+        }
+        return insert(std::forward<Args>(args)...);
+    }
+
+    /**
+     * @brief Remove top(), O(log n). Its handle becomes free.
+     */
+    void pop() { erase_at(0); }
+
+    /**
+     * @brief Remove the element of handle 'h', O(log n). The handle becomes free.
+     */
+    void erase(handle_type h) { erase_at(pos_[h]); }
+
+    /**
+     * @brief Replace the value of handle 'h' with a value not greater than it: the element
+     *        can only move toward the top. O(log n).
+     */
+    void decrease_key(handle_type h, const value_type& value)
+    {
+        heap_[pos_[h]].value = value;
+        sift_up(pos_[h]);
+    }
+
+    void decrease_key(handle_type h, value_type&& value)
+    {
+        heap_[pos_[h]].value = std::move(value);
+        sift_up(pos_[h]);
+    }
+
+    /**
+     * @brief Replace the value of handle 'h' with a value not less than it: the element can
+     *        only move toward the bottom. O(log n).
+     */
+    void increase_key(handle_type h, const value_type& value)
+    {
+        heap_[pos_[h]].value = value;
+        sift_down(pos_[h]);
+    }
+
+    void increase_key(handle_type h, value_type&& value)
+    {
+        heap_[pos_[h]].value = std::move(value);
+        sift_down(pos_[h]);
+    }
+
+    /**
+     * @brief Replace the value of handle 'h' with any value. O(log n).
+     */
+    void update(handle_type h, const value_type& value)
+    {
+        value_type x(value);
+        update(h, std::move(x));
+    }
+
+    void update(handle_type h, value_type&& value)
+    {
+        const size_type i = pos_[h];
+        const bool up = comp_(value, heap_[i].value);
+        heap_[i].value = std::move(value);
+        up ? sift_up(i) : sift_down(i);
+    }
+
+    /**
+     * @brief Remove every element. Every handle becomes free.
+     */
+    void clear()
+    {
+        mem::destroy(heap_, heap_ + size_);
+        size_ = 0;
+        handles_ = 0;
+        free_ = no_handle;
+    }
+
+    void swap(self& other) noexcept
+    {
+        std::swap(heap_, other.heap_);
+        std::swap(pos_, other.pos_);
+        std::swap(size_, other.size_);
+        std::swap(handles_, other.handles_);
+        std::swap(capacity_, other.capacity_);
+        std::swap(free_, other.free_);
+        std::swap(comp_, other.comp_);
+    }
+
+protected:  // internal methods
+    // Put a node at heap index 'i' and record its position
+    void place(size_type i, node&& n)
+    {
+        heap_[i] = std::move(n);
+        pos_[heap_[i].handle] = i;
+    }
+
+    // Construct the element at the end of the heap, with a free or a new handle, then sift it
+    // up. The capacity must allow one more element.
+    template<typename... Args>
+    handle_type insert(Args&&... args)
+    {
+        const handle_type h = free_ != no_handle ? free_ : handles_;
+        mem::construct(heap_ + size_, node{value_type(std::forward<Args>(args)...), h});
+        if (h == free_) {
+            free_ = pos_[h] & ~free_bit;
+        } else {
+            ++handles_;
+        }
+        pos_[h] = size_;
+        ++size_;
+        sift_up(size_ - 1);
+        return h;
+    }
+
+    // Remove the node at heap index 'i': the last node takes its place and moves up or down
+    void erase_at(size_type i)
+    {
+        const handle_type h = heap_[i].handle;
+        const size_type last = size_ - 1;
+        const bool up = i != last && comp_(heap_[last].value, heap_[i].value);
+        if (i != last) {
+            place(i, std::move(heap_[last]));
+        }
+        mem::destroy(heap_ + last);
+        size_ = last;
+        pos_[h] = free_bit | free_;
+        free_ = h;
+        if (i != last) {
+            up ? sift_up(i) : sift_down(i);
+        }
+    }
+
+    // Move the node at heap index 'i' up while it is less than its parent
+    void sift_up(size_type i)
+    {
+        node x = std::move(heap_[i]);
+        try {
+            while (i > 0) {
+                const size_type parent = (i - 1) / Arity;
+                if (!comp_(x.value, heap_[parent].value)) {
+                    break;
+                }
+                place(i, std::move(heap_[parent]));
+                i = parent;
+            }
+        } catch (...) {
+            place(i, std::move(x));  // every node stays in the heap, maybe out of order
+            throw;
+        }
+        place(i, std::move(x));
+    }
+
+    // Move the node at heap index 'i' down while one of its children is less than it
+    void sift_down(size_type i)
+    {
+        node x = std::move(heap_[i]);
+        try {
+            for (;;) {
+                const size_type child = Arity * i + 1;
+                if (child >= size_) {
+                    break;
+                }
+                const size_type end = size_ - child < Arity ? size_ : child + Arity;
+                size_type best = child;
+                for (size_type c = child + 1; c < end; ++c) {
+                    best = comp_(heap_[c].value, heap_[best].value) ? c : best;
+                }
+                if (!comp_(heap_[best].value, x.value)) {
+                    break;
+                }
+                place(i, std::move(heap_[best]));
+                i = best;
+            }
+        } catch (...) {
+            place(i, std::move(x));
+            throw;
+        }
+        place(i, std::move(x));
+    }
+
+    // Move the nodes and the position map to arrays of 'new_cap' entries
+    void reallocate(size_type new_cap)
+    {
+        node* heap = node_allocator::allocate(new_cap);
+        try {
+            mem::uninitialized_move(heap_, heap_ + size_, heap);
+        } catch (...) {
+            node_allocator::deallocate(heap, new_cap);
+            throw;
+        }
+        size_type* pos;
+        try {
+            pos = position_allocator::allocate(new_cap);
+        } catch (...) {
+            mem::destroy(heap, heap + size_);
+            node_allocator::deallocate(heap, new_cap);
+            throw;
+        }
+        mem::uninitialized_copy(pos_, pos_ + handles_, pos);
+        if (heap_) {
+            mem::destroy(heap_, heap_ + size_);
+            node_allocator::deallocate(heap_, capacity_);
+            position_allocator::deallocate(pos_, capacity_);
+        }
+        heap_ = heap;
+        pos_ = pos;
+        capacity_ = new_cap;
+    }
+
+protected:
+    node* heap_;           // nodes in heap order, 'size_' constructed
+    size_type* pos_;       // heap index of each handle, or free_bit | next free handle
+    size_type size_;       // number of elements
+    size_type handles_;    // number of handles ever given out, at most 'capacity_'
+    size_type capacity_;   // number of entries of both arrays
+    handle_type free_;     // first free handle, or no_handle
+    Compare comp_;         // order of the values
+};
+
+}  // namespace mini::ctnr
+
+#endif
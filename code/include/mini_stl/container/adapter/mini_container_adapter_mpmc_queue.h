@@ -0,0 +1,437 @@
+#ifndef MINI_CONTAINER_ADAPTER_MPMC_QUEUE_H
+#define MINI_CONTAINER_ADAPTER_MPMC_QUEUE_H
+
+#include "mini_stl/base/mini_base_macro.h"
+#include "mini_stl/memory/mini_memory.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <utility>
+
+namespace mini::ctnr {
+
+/**
+ * @brief Bounded lock-free queue for any number of producer and consumer threads.
+ *
+ * Every slot carries a sequence number (D. Vyukov's bounded MPMC queue). For logical position
+ * pos, the slot is free for the producer of pos when sequence == pos, and holds the element for
+ * the consumer of pos when sequence == pos + 1. Consuming sets it to pos + capacity, which is
+ * the next producer's turn. A thread claims a position with one CAS on the shared enqueue or
+ * dequeue counter, then owns the slot until it publishes the new sequence number.
+ *
+ * @attention try_* operations never block. push()/pop() spin for a while, then sleep on a
+ *            condition variable until the other side makes progress. Waiters are counted, so the
+ *            non-blocking paths never touch the mutex while nobody sleeps.
+ * @attention Batch operations claim up to n consecutive positions with a single CAS.
+ * @attention T must be nothrow move constructible: a claimed slot must always be filled.
+ *            Elements are constructed in place when that cannot throw, otherwise they are
+ *            built before a slot is claimed and moved in.
+ * @tparam T value type
+ * @tparam Allocator 1st level allocator or sub-allocator for the slots, cache-line aligned by
+ *                   default
+ */
+template<typename T, typename Allocator = mem::cache_aligned_alloc>
+class mpmc_queue {
+    static_assert(std::is_nothrow_move_constructible<T>::value,
+        "mpmc_queue requires a nothrow move constructible value type");
+    static_assert(std::is_nothrow_destructible<T>::value,
+        "mpmc_queue requires a nothrow destructible value type");
+
+    MINI_DISALLOW_COPY_AND_MOVE(mpmc_queue);
+
+public:
+    typedef T value_type;
+    typedef value_type& reference;
+    typedef const value_type& const_reference;
+    typedef size_t size_type;
+
+protected:
+    struct cell {
+        std::atomic<size_type> sequence;
+        alignas(T) unsigned char storage[sizeof(T)];
+
+        T* data() { return reinterpret_cast<T*>(storage); }
+    };
+
+    typedef mem::simple_alloc<cell, Allocator> cell_allocator;
+
+    // Threads sleeping in a blocking operation of one kind (push or pop)
+    struct waiter_list {
+        std::atomic<int> waiters{0};     // number of threads in wait()
+        std::atomic<unsigned> epoch{0};  // bumped by every notification
+        std::condition_variable cv;
+    };
+
+    // iterations of busy waiting before a blocking operation goes to sleep
+    enum { spin_count = 128 };
+
+public:
+    /**
+     * @param capacity Minimum number of elements the queue can hold, rounded up to a power of
+     *                 two (at least 2)
+     */
+    explicit mpmc_queue(size_type capacity)
+        : enqueue_pos_(0)
+        , dequeue_pos_(0)
+        , buf_(0)
+        , capacity_(round_up(capacity))
+        , mask_(capacity_ - 1)
+    {
+        buf_ = cell_allocator::allocate(capacity_);
+        for (size_type i = 0; i < capacity_; ++i) {
+            mem::construct(&buf_[i].sequence, i);
+        }
+    }
+
+    ~mpmc_queue()
+    {
+        // no other thread can be running: filled slots are the ones left to destroy
+        for (size_type pos = dequeue_pos_.load(std::memory_order_relaxed);; ++pos) {
+            cell* c = &buf_[pos & mask_];
+            if (c->sequence.load(std::memory_order_relaxed) != pos + 1) {
+                break;
+            }
+            mem::destroy(c->data());
+        }
+        cell_allocator::deallocate(buf_, capacity_);
+    }
+
+public:
+    // Non-blocking operations
+
+    template<typename... Args>
+    bool try_emplace(Args&&... args)
+    {
+        if constexpr (std::is_nothrow_constructible<T, Args&&...>::value) {
+            size_type pos;
+            cell* c = claim_push(pos);
+            if (!c) {
+                return false;
+            }
+            mem::construct(c->data(), std::forward<Args>(args)...);
+            publish_push(c, pos);
+            return true;
+        } else {
+            // construction may throw: do it before any slot is claimed
+            value_type x(std::forward<Args>(args)...);
+            return try_emplace(std::move(x));
+        }
+    }
+
+    bool try_push(const_reference value) { return try_emplace(value); }
+
+    bool try_push(value_type&& value) { return try_emplace(std::move(value)); }
+
+    bool try_pop(reference value)
+    {
+        size_type pos;
+        cell* c = claim_pop(pos);
+        if (!c) {
+            return false;
+        }
+        consume(c, pos, value);
+        return true;
+    }
+
+    /**
+     * @brief Push up to n elements copied from [first, first + n).
+     *
+     * @attention Consecutive free slots are claimed with one CAS. Elements whose copy can throw
+     *            are pushed one by one instead.
+     * @return size_type Number of elements pushed, the first ones of the range
+     */
+    template<typename ForwardIterator>
+    size_type try_push_n(ForwardIterator first, size_type n)
+    {
+        typedef decltype(*first) source_reference;
+        if constexpr (std::is_nothrow_constructible<T, source_reference>::value) {
+            if (n == 0) {
+                return 0;
+            }
+            size_type pos = enqueue_pos_.load(std::memory_order_relaxed);
+            size_type count;
+            for (;;) {
+                count = ready_slots(pos, n, 0);
+                if (count == 0) {
+                    if (intptr_t(slot_sequence(pos)) - intptr_t(pos) < 0) {
+                        return 0;  // full
+                    }
+                    pos = enqueue_pos_.load(std::memory_order_relaxed);  // another producer won
+                    continue;
+                }
+                if (enqueue_pos_.compare_exchange_weak(
+                        pos, pos + count, std::memory_order_relaxed)) {
+                    break;
+                }
+            }
+            for (size_type i = 0; i < count; ++i, ++first) {
+                cell* c = &buf_[(pos + i) & mask_];
+                mem::construct(c->data(), *first);
+                c->sequence.store(pos + i + 1, std::memory_order_release);
+            }
+            notify_consumers(count);
+            return count;
+        } else {
+            size_type count = 0;
+            for (; count < n && try_push(*first); ++count, ++first) {}
+            return count;
+        }
+    }
+
+    /**
+     * @brief Pop up to n elements, moving them to 'result'.
+     *
+     * @attention Consecutive ready elements are claimed with one CAS.
+     * @return size_type Number of elements popped
+     */
+    template<typename OutputIterator>
+    size_type try_pop_n(OutputIterator result, size_type n)
+    {
+        if (n == 0) {
+            return 0;
+        }
+        size_type pos = dequeue_pos_.load(std::memory_order_relaxed);
+        size_type count;
+        for (;;) {
+            count = ready_slots(pos, n, 1);
+            if (count == 0) {
+                if (intptr_t(slot_sequence(pos)) - intptr_t(pos + 1) < 0) {
+                    return 0;  // empty
+                }
+                pos = dequeue_pos_.load(std::memory_order_relaxed);  // another consumer won
+                continue;
+            }
+            if (dequeue_pos_.compare_exchange_weak(pos, pos + count, std::memory_order_relaxed)) {
+                break;
+            }
+        }
+        size_type i = 0;
+        try {
+            for (; i < count; ++i, ++result) {
+                cell* c = &buf_[(pos + i) & mask_];
+                *result = std::move(*c->data());
+                release_slot(c, pos + i);
+            }
+        } catch (...) {
+            // claimed slots must be handed back: the remaining elements are dropped
+            for (; i < count; ++i) {
+                release_slot(&buf_[(pos + i) & mask_], pos + i);
+            }
+            notify_producers(count);
+            throw;
+        }
+        notify_producers(count);
+        return count;
+    }
+
+    // Blocking operations
+
+    /**
+     * @brief Push an element, waiting for a free slot if the queue is full.
+     */
+    template<typename... Args>
+    void emplace(Args&&... args)
+    {
+        // built once, so that retries do not consume 'args'
+        value_type x(std::forward<Args>(args)...);
+        for (int i = 0; i < spin_count; ++i) {
+            if (try_emplace(std::move(x))) {
+                return;
+            }
+            spin_pause(i);
+        }
+        wait(producers_, [&] { return try_emplace(std::move(x)); });
+    }
+
+    void push(const_reference value) { emplace(value); }
+
+    void push(value_type&& value) { emplace(std::move(value)); }
+
+    /**
+     * @brief Pop an element, waiting for one if the queue is empty.
+     */
+    void pop(reference value)
+    {
+        for (int i = 0; i < spin_count; ++i) {
+            if (try_pop(value)) {
+                return;
+            }
+            spin_pause(i);
+        }
+        wait(consumers_, [&] { return try_pop(value); });
+    }
+
+    // Observers
+
+    size_type capacity() const { return capacity_; }
+
+    // A snapshot, may be stale as soon as it is returned
+    size_type size() const
+    {
+        const size_type head = dequeue_pos_.load(std::memory_order_acquire);
+        const size_type tail = enqueue_pos_.load(std::memory_order_acquire);
+        return tail > head ? tail - head : 0;
+    }
+
+    bool empty() const { return size() == 0; }
+
+protected:
+    static size_type round_up(size_type n)
+    {
+        size_type cap = 2;
+        while (cap < n) {
+            cap <<= 1;
+        }
+        return cap;
+    }
+
+    size_type slot_sequence(size_type pos) const
+    {
+        return buf_[pos & mask_].sequence.load(std::memory_order_acquire);
+    }
+
+    // Number of consecutive slots from 'pos' (at most n) whose sequence is pos + i + offset:
+    // offset 0 checks for free slots, offset 1 for filled ones
+    size_type ready_slots(size_type pos, size_type n, size_type offset) const
+    {
+        size_type i = 0;
+        for (; i < n && slot_sequence(pos + i) == pos + i + offset; ++i) {}
+        return i;
+    }
+
+    // Claim the next free position, or return null if the queue is full
+    cell* claim_push(size_type& pos)
+    {
+        pos = enqueue_pos_.load(std::memory_order_relaxed);
+        for (;;) {
+            cell* c = &buf_[pos & mask_];
+            size_type seq = c->sequence.load(std::memory_order_acquire);
+            intptr_t diff = intptr_t(seq) - intptr_t(pos);
+            if (diff == 0) {
+                if (enqueue_pos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    return c;
+                }
+            } else if (diff < 0) {
+                return 0;  // slot still holds the element of the previous lap
+            } else {
+                pos = enqueue_pos_.load(std::memory_order_relaxed);  // another producer won
+            }
+        }
+    }
+
+    // Claim the next filled position, or return null if the queue is empty
+    cell* claim_pop(size_type& pos)
+    {
+        pos = dequeue_pos_.load(std::memory_order_relaxed);
+        for (;;) {
+            cell* c = &buf_[pos & mask_];
+            size_type seq = c->sequence.load(std::memory_order_acquire);
+            intptr_t diff = intptr_t(seq) - intptr_t(pos + 1);
+            if (diff == 0) {
+                if (dequeue_pos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    return c;
+                }
+            } else if (diff < 0) {
+                return 0;  // slot not yet filled for this lap
+            } else {
+                pos = dequeue_pos_.load(std::memory_order_relaxed);  // another consumer won
+            }
+        }
+    }
+
+    void publish_push(cell* c, size_type pos)
+    {
+        c->sequence.store(pos + 1, std::memory_order_release);
+        notify_consumers(1);
+    }
+
+    void consume(cell* c, size_type pos, reference value)
+    {
+        try {
+            value = std::move(*c->data());
+        } catch (...) {
+            release_slot(c, pos);  // the element is dropped, the slot is not lost
+            notify_producers(1);
+            throw;
+        }
+        release_slot(c, pos);
+        notify_producers(1);
+    }
+
+    void release_slot(cell* c, size_type pos)
+    {
+        mem::destroy(c->data());
+        c->sequence.store(pos + capacity_, std::memory_order_release);
+    }
+
+    void notify_consumers(size_type n) { notify(consumers_, n); }
+
+    void notify_producers(size_type n) { notify(producers_, n); }
+
+    // The seq_cst fence orders the preceding sequence store before the waiter count load,
+    // pairing with the fence in wait(): either the waiter sees the new state or we see the waiter.
+    void notify(waiter_list& list, size_type n)
+    {
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (list.waiters.load(std::memory_order_relaxed) == 0) {
+            return;
+        }
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            list.epoch.fetch_add(1, std::memory_order_release);
+        }
+        if (n == 1) {
+            list.cv.notify_one();
+        } else {
+            list.cv.notify_all();
+        }
+    }
+
+    // Retry 'done' until it succeeds, sleeping between attempts. 'done' runs without the mutex
+    // (it may notify the other side); a notification between a failed attempt and the sleep is
+    // not lost because it changes the epoch read before the attempt.
+    template<typename Predicate>
+    void wait(waiter_list& list, Predicate done)
+    {
+        list.waiters.fetch_add(1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        for (;;) {
+            const unsigned epoch = list.epoch.load(std::memory_order_acquire);
+            if (done()) {
+                break;
+            }
+            std::unique_lock<std::mutex> lock(mutex_);
+            list.cv.wait(lock, [&] { return list.epoch.load(std::memory_order_relaxed) != epoch; });
+        }
+        list.waiters.fetch_sub(1, std::memory_order_relaxed);
+    }
+
+    static void spin_pause(int i)
+    {
+        if (i >= spin_count / 2) {
+            std::this_thread::yield();
+        }
+    }
+
+protected:
+    alignas(mem::cache_line_size) std::atomic<size_type> enqueue_pos_;  // next position to push
+    alignas(mem::cache_line_size) std::atomic<size_type> dequeue_pos_;  // next position to pop
+
+    // read-only after construction
+    alignas(mem::cache_line_size) cell* buf_;
+    size_type capacity_;  // power of two
+    size_type mask_;      // capacity_ - 1
+
+    // blocking support, only touched when a blocking operation has to sleep
+    alignas(mem::cache_line_size) waiter_list producers_;  // waiting for a free slot
+    waiter_list consumers_;                                // waiting for an element
+    std::mutex mutex_;
+};
+
+}  // namespace mini::ctnr
+
+#endif
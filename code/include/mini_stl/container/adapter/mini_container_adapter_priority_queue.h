@@ -4,17 +4,83 @@
 #include "mini_stl/algorithm/mini_algorithm_heap.h"
 #include "mini_stl/container/mini_container_vector.h"
 
+#include <cstddef>
+#include <functional>
+#include <utility>
+
 namespace mini::ctnr {
 
+/**
+ * @brief Heap layout of a priority_queue: the binary heap of algo::push_heap/pop_heap.
+ */
+struct binary_heap_policy {
+    template<typename RandomAccessIterator, typename Compare>
+    static void make(RandomAccessIterator first, RandomAccessIterator last, const Compare& comp)
+    {
+        algo::make_heap(first, last, comp);
+    }
+
+    template<typename RandomAccessIterator, typename Compare>
+    static void push(RandomAccessIterator first, RandomAccessIterator last, const Compare& comp)
+    {
+        algo::push_heap(first, last, comp);
+    }
+
+    template<typename RandomAccessIterator, typename Compare>
+    static void pop(RandomAccessIterator first, RandomAccessIterator last, const Compare& comp)
+    {
+        algo::pop_heap(first, last, comp);
+    }
+};
+
+/**
+ * @brief Heap layout of a priority_queue: 'Arity' children per node, see algo::pop_dary_heap.
+ *
+ * @attention A 4-ary heap is half as deep as a binary one and scans each child group in one
+ *            cache line or two: fewer cache misses per pop on large queues, for about 1.5 times
+ *            the comparisons. Prefer it unless comparisons are expensive.
+ */
+template<size_t Arity = 4>
+struct dary_heap_policy {
+    static_assert(Arity >= 2, "a heap node has at least two children");
+
+    template<typename RandomAccessIterator, typename Compare>
+    static void make(RandomAccessIterator first, RandomAccessIterator last, const Compare& comp)
+    {
+        algo::make_dary_heap<Arity>(first, last, comp);
+    }
+
+    template<typename RandomAccessIterator, typename Compare>
+    static void push(RandomAccessIterator first, RandomAccessIterator last, const Compare& comp)
+    {
+        algo::push_dary_heap<Arity>(first, last, comp);
+    }
+
+    template<typename RandomAccessIterator, typename Compare>
+    static void pop(RandomAccessIterator first, RandomAccessIterator last, const Compare& comp)
+    {
+        algo::pop_dary_heap<Arity>(first, last, comp);
+    }
+};
+
+/**
+ * @brief Heap on top of a random access sequence: top() is the element for which comp(x, top)
+ *        is false for every x.
+ *
+ * @tparam HeapPolicy Heap layout: binary_heap_policy, or dary_heap_policy<Arity>
+ */
 template<typename T, typename Sequence = vector<T>,
-    typename Compare = std::less<typename Sequence::value_type>>
+    typename Compare = std::less<typename Sequence::value_type>,
+    typename HeapPolicy = binary_heap_policy>
 class priority_queue {
 public:
-    typedef priority_queue<T, Sequence> self;
+    typedef priority_queue<T, Sequence, Compare, HeapPolicy> self;
     typedef typename Sequence::value_type value_type;
     typedef typename Sequence::size_type size_type;
     typedef typename Sequence::reference reference;
     typedef typename Sequence::const_reference const_reference;
+    typedef Compare value_compare;
+    typedef HeapPolicy heap_policy;
 
 public:
     priority_queue()
@@ -31,7 +97,7 @@ public:
         : c_(first, last)
         , comp_(comp)
     {
-        algo::make_heap(c_.begin(), c_.end());
+        HeapPolicy::make(c_.begin(), c_.end(), comp_);
     }
 
 public:
@@ -45,7 +111,38 @@ public:
     {
         try {
             c_.push_back(value);
-            algo::push_heap(c_.begin(), c_.end());
+            HeapPolicy::push(c_.begin(), c_.end(), comp_);
+        } catch (...) {
+            c_.clear();
+        }
+    }
+
+    /**
+     * @brief Insert the elements of [first, last) at once.
+     *
+     * @attention Appends them, then restores the heap either by sifting each one up, O(k log n)
+     *            at worst for k new elements but about O(k) on random ones, or by rebuilding the
+     *            whole heap bottom-up (Floyd), O(n + k) whatever their order. The rebuild is chosen
+     *            when the new elements are at least twice as many as the old ones: below that,
+     *            random batches sift up faster than a rebuild, and only batches sorted toward the
+     *            top, which sift all the way up, would gain from rebuilding earlier.
+     */
+    template<typename InputIterator>
+    void push_range(InputIterator first, InputIterator last)
+    {
+        try {
+            const size_type old_size = c_.size();
+            for (; first != last; ++first) {
+                c_.push_back(*first);
+            }
+            const size_type count = c_.size() - old_size;
+            if (count >= 2 * old_size) {
+                HeapPolicy::make(c_.begin(), c_.end(), comp_);
+            } else {
+                for (auto it = c_.begin() + old_size; it != c_.end();) {
+                    HeapPolicy::push(c_.begin(), ++it, comp_);
+                }
+            }
         } catch (...) {
             c_.clear();
         }
@@ -54,13 +151,42 @@ public:
     void pop()
     {
         try {
-            algo::pop_heap(c_.begin(), c_.end());
+            HeapPolicy::pop(c_.begin(), c_.end(), comp_);
+            c_.pop_back();
+        } catch (...) {
+            c_.clear();
+        }
+    }
+
+    /**
+     * @brief Move top() to 'out', then remove it: no copy of the element.
+     */
+    void pop_into(value_type& out)
+    {
+        try {
+            HeapPolicy::pop(c_.begin(), c_.end(), comp_);
+            out = std::move(c_.back());
             c_.pop_back();
         } catch (...) {
             c_.clear();
         }
     }
 
+    /**
+     * @brief Remove top() and return it, moved out of the queue.
+     *
+     * @attention There is no element to return should a move or a comparison throw: the
+     *            exception propagates, leaving every element in the queue, not necessarily in
+     *            heap order.
+     */
+    value_type take_top()
+    {
+        HeapPolicy::pop(c_.begin(), c_.end(), comp_);
+        value_type top(std::move(c_.back()));
+        c_.pop_back();
+        return top;
+    }
+
 protected:
     Sequence c_;
     Compare comp_;  // compare for value
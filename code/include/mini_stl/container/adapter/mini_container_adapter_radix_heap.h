@@ -0,0 +1,173 @@
+#ifndef MINI_CONTAINER_ADAPTER_RADIX_HEAP_H
+#define MINI_CONTAINER_ADAPTER_RADIX_HEAP_H
+
+#include "mini_stl/base/mini_base_macro.h"
+#include "mini_stl/container/mini_container_vector.h"
+#include "mini_stl/functional/mini_functional_base.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+#include <utility>
+
+namespace mini::ctnr {
+
+/**
+ * @brief Monotone min-queue on unsigned integer keys: the key of a pushed element must not be
+ *        less than the key of the last popped one (or last returned by top()), as timestamps in
+ *        an event simulation.
+ *
+ * @attention No comparison between elements. Bucket 0 holds the elements whose key equals the
+ *            last popped key 'last', bucket b the elements whose key first differs from 'last'
+ *            at bit b - 1, counting from the least significant one. When bucket 0 runs empty,
+ *            the first nonempty bucket is spread over the lower ones around its smallest key,
+ *            the new 'last': each element only moves down, so push() costs O(1) and pop()
+ *            amortized O(log C) for keys up to C, a pop_back() most of the time.
+ * @attention Replaces priority_queue<T, Sequence, std::greater<T>> (smallest key on top) with the
+ *            same interface, for monotone workloads. Elements of equal keys come out in any order.
+ * @attention top() is const but redistributes the buckets when bucket 0 is empty, so unlike the
+ *            const members of other containers it must not run concurrently with any other call,
+ *            top() included. Refilling in pop() instead would raise last_key() to the next
+ *            smallest key, and reject keys between the two that the caller may still push.
+ * @tparam T value type
+ * @tparam KeyOfValue function object extracting the unsigned integer key of a value
+ * @tparam Sequence storage of a bucket, with push_back, pop_back, back, clear
+ */
+template<typename T, typename KeyOfValue = func::identity, typename Sequence = vector<T>>
+class radix_heap {
+public:
+    typedef radix_heap<T, KeyOfValue, Sequence> self;
+    typedef typename Sequence::value_type value_type;
+    typedef typename Sequence::size_type size_type;
+    typedef typename Sequence::reference reference;
+    typedef typename Sequence::const_reference const_reference;
+    typedef std::decay_t<decltype(std::declval<const KeyOfValue&>()(
+        std::declval<const value_type&>()))>
+        key_type;
+
+    static_assert(std::is_unsigned_v<key_type>, "radix_heap keys are unsigned integers");
+    static_assert(std::numeric_limits<key_type>::digits <= 64, "at most 64 bits per key");
+
+protected:
+    // bucket 0, then one bucket per bit of a key
+    static constexpr size_t bucket_count = std::numeric_limits<key_type>::digits + 1;
+
+public:
+    explicit radix_heap(const KeyOfValue& key_of = KeyOfValue())
+        : size_(0)
+        , last_(0)
+        , nonempty_(0)
+        , key_of_(key_of)
+    {}
+
+    MINI_DISALLOW_COPY_AND_MOVE(radix_heap);
+
+public:
+    bool empty() const { return size_ == 0; }
+
+    size_type size() const { return size_; }
+
+    /**
+     * @brief An element of the smallest key, amortized O(log C).
+     *
+     * @attention Not thread-safe even on a const heap: see the class notes.
+     */
+    const_reference top() const
+    {
+        if (buckets_[0].empty()) {
+            refill();
+        }
+        return buckets_[0].back();
+    }
+
+    /**
+     * @brief Key of the last element returned by top() or popped: the smallest key push()
+     *        accepts
+     */
+    key_type last_key() const { return last_; }
+
+    /**
+     * @brief Insert 'value', O(1).
+     *
+     * @attention The key of 'value' must not be less than last_key().
+     */
+    void push(const_reference value)
+    {
+        const size_t b = bucket(key_of_(value));
+        buckets_[b].push_back(value);
+        nonempty_ |= mask(b);
+        ++size_;
+    }
+
+    /**
+     * @brief Remove top(), amortized O(log C).
+     */
+    void pop()
+    {
+        if (buckets_[0].empty()) {
+            refill();
+        }
+        buckets_[0].pop_back();
+        --size_;
+    }
+
+    /**
+     * @brief Remove every element. Every key is accepted again.
+     */
+    void clear()
+    {
+        for (Sequence& b : buckets_) {
+            b.clear();
+        }
+        size_ = 0;
+        last_ = 0;
+        nonempty_ = 0;
+    }
+
+protected:  // internal methods
+    // Bucket of 'key' relative to the last popped key: 1 + index of the highest differing bit
+    size_t bucket(key_type key) const
+    {
+        const uint64_t diff = uint64_t(key ^ last_);
+        return diff == 0 ? 0 : size_t(64 - __builtin_clzll(diff));
+    }
+
+    // Bit of bucket 'b' in 'nonempty_', none for bucket 0
+    static uint64_t mask(size_t b) { return b == 0 ? 0 : uint64_t(1) << (b - 1); }
+
+    // Spread the first nonempty bucket over the lower ones, around its smallest key. Only when
+    // the smallest key is asked for: 'last_' must not pass a key the caller may still push.
+    void refill() const
+    {
+        const size_t from = size_t(__builtin_ctzll(nonempty_)) + 1;
+        Sequence& src = buckets_[from];
+        key_type smallest = key_of_(src.back());
+        for (auto it = src.begin(); it != src.end(); ++it) {
+            const key_type key = key_of_(*it);
+            smallest = key < smallest ? key : smallest;
+        }
+        last_ = smallest;
+        // every key of the bucket shares the bits above 'from - 1' with the new 'last_', and
+        // differs from it below: each element lands in a bucket lower than 'from'
+        for (auto it = src.begin(); it != src.end(); ++it) {
+            const size_t b = bucket(key_of_(*it));
+            buckets_[b].push_back(std::move(*it));
+            nonempty_ |= mask(b);
+        }
+        src.clear();
+        nonempty_ &= ~mask(from);
+    }
+
+protected:
+    // top() refills bucket 0
+    mutable Sequence buckets_[bucket_count];  // bucket b: first differing from 'last_' at bit b - 1
+    size_type size_;                          // number of elements
+    mutable key_type last_;                   // key of the last element seen by top() or pop()
+    mutable uint64_t nonempty_;               // bit b - 1 set when bucket b > 0 is nonempty
+    KeyOfValue key_of_;                       // key of a value
+};
+
+}  // namespace mini::ctnr
+
+#endif
@@ -0,0 +1,210 @@
+#ifndef MINI_CONTAINER_ADAPTER_SPSC_QUEUE_H
+#define MINI_CONTAINER_ADAPTER_SPSC_QUEUE_H
+
+#include "mini_stl/algorithm/mini_algorithm.h"
+#include "mini_stl/base/mini_base_macro.h"
+#include "mini_stl/memory/mini_memory.h"
+
+#include <atomic>
+#include <utility>
+
+namespace mini::ctnr {
+
+/**
+ * @brief Bounded wait-free queue for exactly one producer thread and one consumer thread.
+ *
+ * @attention Only one thread may call the try_push*() family and only one (other) thread may
+ *            call the try_pop*() family. size() and empty() are snapshots.
+ * @attention head_ (written by the consumer) and tail_ (written by the producer) live on their
+ *            own cache lines. Each side also keeps a cached copy of the other side's index and
+ *            only re-reads the shared one when the cached copy says the queue is full (producer)
+ *            or empty (consumer), so in steady state each operation touches no line written by
+ *            the other thread except the slot itself.
+ * @attention Batch operations publish n elements with one release store.
+ * @tparam T value type
+ * @tparam Allocator 1st level allocator or sub-allocator for the slots, cache-line aligned by
+ *                   default
+ */
+template<typename T, typename Allocator = mem::cache_aligned_alloc>
+class spsc_queue {
+    MINI_DISALLOW_COPY_AND_MOVE(spsc_queue);
+
+public:
+    typedef T value_type;
+    typedef value_type& reference;
+    typedef const value_type& const_reference;
+    typedef size_t size_type;
+
+protected:
+    typedef mem::simple_alloc<value_type, Allocator> data_allocator;
+
+public:
+    /**
+     * @param capacity Minimum number of elements the queue can hold, rounded up to a power of two
+     */
+    explicit spsc_queue(size_type capacity)
+        : head_(0)
+        , cached_tail_(0)
+        , tail_(0)
+        , cached_head_(0)
+        , buf_(0)
+        , capacity_(round_up(capacity))
+        , mask_(capacity_ - 1)
+    {
+        buf_ = data_allocator::allocate(capacity_);
+    }
+
+    ~spsc_queue()
+    {
+        size_type head = head_.load(std::memory_order_relaxed);
+        size_type tail = tail_.load(std::memory_order_relaxed);
+        for (; head != tail; ++head) {
+            mem::destroy(buf_ + (head & mask_));
+        }
+        data_allocator::deallocate(buf_, capacity_);
+    }
+
+public:
+    // Producer side
+
+    template<typename... Args>
+    bool try_emplace(Args&&... args)
+    {
+        const size_type tail = tail_.load(std::memory_order_relaxed);
+        if (tail - cached_head_ == capacity_) {
+            cached_head_ = head_.load(std::memory_order_acquire);
+            if (tail - cached_head_ == capacity_) {
+                return false;  // full
+            }
+        }
+        mem::construct(buf_ + (tail & mask_), std::forward<Args>(args)...);
+        tail_.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    bool try_push(const_reference value) { return try_emplace(value); }
+
+    bool try_push(value_type&& value) { return try_emplace(std::move(value)); }
+
+    /**
+     * @brief Push up to n elements copied from [first, first + n).
+     *
+     * @return size_type Number of elements pushed, the first ones of the range
+     */
+    template<typename ForwardIterator>
+    size_type try_push_n(ForwardIterator first, size_type n)
+    {
+        const size_type tail = tail_.load(std::memory_order_relaxed);
+        size_type free = capacity_ - (tail - cached_head_);
+        if (free < n) {
+            cached_head_ = head_.load(std::memory_order_acquire);
+            free = capacity_ - (tail - cached_head_);
+        }
+        const size_type count = n < free ? n : free;
+
+        // free slots form at most two contiguous runs
+        const size_type run = run_length(tail, count);
+        ForwardIterator mid = first;
+        iter::advance(mid, run);
+        mem::uninitialized_copy(first, mid, buf_ + (tail & mask_));
+        ForwardIterator last = mid;
+        iter::advance(last, count - run);
+        mem::uninitialized_copy(mid, last, buf_);
+
+        tail_.store(tail + count, std::memory_order_release);
+        return count;
+    }
+
+    // Consumer side
+
+    bool try_pop(reference value)
+    {
+        const size_type head = head_.load(std::memory_order_relaxed);
+        if (head == cached_tail_) {
+            cached_tail_ = tail_.load(std::memory_order_acquire);
+            if (head == cached_tail_) {
+                return false;  // empty
+            }
+        }
+        value_type* slot = buf_ + (head & mask_);
+        value = std::move(*slot);
+        mem::destroy(slot);
+        head_.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief Pop up to n elements, moving them to 'result'.
+     *
+     * @return size_type Number of elements popped
+     */
+    template<typename OutputIterator>
+    size_type try_pop_n(OutputIterator result, size_type n)
+    {
+        const size_type head = head_.load(std::memory_order_relaxed);
+        size_type available = cached_tail_ - head;
+        if (available < n) {
+            cached_tail_ = tail_.load(std::memory_order_acquire);
+            available = cached_tail_ - head;
+        }
+        const size_type count = n < available ? n : available;
+
+        // elements form at most two contiguous runs
+        const size_type run = run_length(head, count);
+        value_type* first = buf_ + (head & mask_);
+        result = algo::move(first, first + run, result);
+        algo::move(buf_, buf_ + (count - run), result);
+        mem::destroy(first, first + run);
+        mem::destroy(buf_, buf_ + (count - run));
+
+        head_.store(head + count, std::memory_order_release);
+        return count;
+    }
+
+    // Observers
+
+    size_type capacity() const { return capacity_; }
+
+    size_type size() const
+    {
+        const size_type head = head_.load(std::memory_order_acquire);
+        return tail_.load(std::memory_order_acquire) - head;
+    }
+
+    bool empty() const { return size() == 0; }
+
+protected:
+    static size_type round_up(size_type n)
+    {
+        size_type cap = 1;
+        while (cap < n) {
+            cap <<= 1;
+        }
+        return cap;
+    }
+
+    // length of the first contiguous run of 'count' slots starting at logical index 'pos'
+    size_type run_length(size_type pos, size_type count) const
+    {
+        const size_type to_end = capacity_ - (pos & mask_);
+        return count < to_end ? count : to_end;
+    }
+
+protected:
+    // consumer cache line
+    alignas(mem::cache_line_size) std::atomic<size_type> head_;  // next slot to pop
+    size_type cached_tail_;  // consumer's last observed tail_
+
+    // producer cache line
+    alignas(mem::cache_line_size) std::atomic<size_type> tail_;  // next slot to push
+    size_type cached_head_;  // producer's last observed head_
+
+    // read-only after construction
+    alignas(mem::cache_line_size) value_type* buf_;
+    size_type capacity_;  // power of two
+    size_type mask_;      // capacity_ - 1
+};
+
+}  // namespace mini::ctnr
+
+#endif
@@ -0,0 +1,411 @@
+#ifndef MINI_CONTAINER_ADAPTER_TIMING_WHEEL_H
+#define MINI_CONTAINER_ADAPTER_TIMING_WHEEL_H
+
+#include "mini_stl/base/mini_base_macro.h"
+#include "mini_stl/memory/mini_memory.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+namespace mini::ctnr {
+
+/**
+ * @brief Hierarchical timing wheel: timers carrying a value of type T, which expire a given
+ *        number of ticks from now. O(1) schedule and cancel, instead of O(log n) in a heap.
+ *
+ * @attention 11 levels of 64 slots cover every 64-bit expiry: level L holds the timers expiring
+ *            between 64^L and 64^(L+1) ticks from now, bucketed by bits [6L, 6L + 6) of their
+ *            expiry. Level 0 slots expire as a whole, one per tick. When the bits of level L of
+ *            the current tick roll over to 0, the slot of level L + 1 they point to is cascaded:
+ *            its timers move down a level or more, at most once per level over their lifetime.
+ * @attention A bitmap of nonempty slots per level lets advance() jump straight to the next tick
+ *            with work to do, so idle ticks cost nothing.
+ * @attention Timer nodes are intrusive doubly linked list nodes, one allocation from the pooled
+ *            'Allocator' per timer and none per list operation. A handle is the node itself: it
+ *            is valid from schedule() until the timer is cancelled, or its callback returns
+ *            without rescheduling it.
+ * @tparam T value type carried by a timer, e.g. a callback
+ * @tparam Allocator 1st level allocator or sub-allocator
+ */
+template<typename T, typename Allocator = mem::alloc>
+class timing_wheel {
+public:  // public typedefs
+    typedef T value_type;
+    typedef value_type& reference;
+    typedef const value_type& const_reference;
+    typedef size_t size_type;
+    typedef uint64_t tick_type;
+
+protected:  // internal typedefs
+    typedef timing_wheel<T, Allocator> self;
+
+    struct link {
+        link* prev;
+        link* next;
+    };
+
+    // timers of a tick being expired, and the batch of the advance() running the callback that
+    // called advance() again, if any
+    struct batch_link : link {
+        batch_link* outer;
+    };
+
+    struct timer_node : link {
+        template<typename... Args>
+        timer_node(tick_type expiry, Args&&... args)
+            : link()
+            , expiry(expiry)
+            , slot(0)
+            , running(false)
+            , value(std::forward<Args>(args)...)
+        {}
+
+        tick_type expiry;  // tick the timer expires at
+        size_type slot;    // index of its list in 'slots_', no_slot when in none
+        bool running;      // its callback is running
+        value_type value;
+    };
+
+    typedef mem::simple_alloc<timer_node, Allocator> node_allocator;
+
+    static constexpr size_type slot_bits = 6;
+    static constexpr size_type slots_per_level = size_type(1) << slot_bits;
+    static constexpr size_type levels = (64 + slot_bits - 1) / slot_bits;
+    static constexpr size_type no_slot = ~size_type(0);
+
+public:
+    typedef timer_node* handle_type;
+
+public:
+    /**
+     * @brief Empty wheel whose current tick is 'now'
+     */
+    explicit timing_wheel(tick_type now = 0)
+        : batch_(0)
+        , now_(now)
+        , size_(0)
+    {
+        for (link& head : slots_) {
+            head.prev = head.next = &head;
+        }
+        for (uint64_t& bits : nonempty_) {
+            bits = 0;
+        }
+    }
+
+    MINI_DISALLOW_COPY_AND_MOVE(timing_wheel);
+
+    ~timing_wheel() { clear(); }
+
+public:
+    bool empty() const { return size_ == 0; }
+
+    /**
+     * @brief Number of pending timers
+     */
+    size_type size() const { return size_; }
+
+    /**
+     * @brief Current tick: the last one advance() went through
+     */
+    tick_type now() const { return now_; }
+
+    /**
+     * @brief Tick a pending timer expires at
+     */
+    tick_type expiry(handle_type h) const { return h->expiry; }
+
+    reference operator[](handle_type h) { return h->value; }
+
+    const_reference operator[](handle_type h) const { return h->value; }
+
+    /**
+     * @brief Schedule a timer carrying a value built from 'args', expiring 'delay' ticks from
+     *        now, or at the next tick if 'delay' is 0. O(1).
+     * @return Handle of the timer
+     */
+    template<typename... Args>
+    handle_type schedule(tick_type delay, Args&&... args)
+    {
+        timer_node* node = node_allocator::allocate();
+        try {
+            mem::construct(node, deadline(delay), std::forward<Args>(args)...);
+        } catch (...) {
+            node_allocator::deallocate(node);
+            throw;
+        }
+        insert(node, now_ + 1);
+        ++size_;
+        return node;
+    }
+
+    /**
+     * @brief Remove a pending timer without running it. O(1).
+     *
+     * @attention Called from the callback of 'h' itself, the timer is destroyed once the callback
+     *            returns, even if the callback rescheduled it first.
+     */
+    void cancel(handle_type h)
+    {
+        if (h->slot != no_slot) {
+            unlink(h);
+            --size_;
+        }
+        if (h->running) {
+            h->slot = no_slot;  // destroyed by expire()
+        } else {
+            destroy_node(h);
+        }
+    }
+
+    /**
+     * @brief Move a pending timer to expire 'delay' ticks from now. O(1).
+     *
+     * @attention Called from the callback of 'h' itself, the timer is pending again once the
+     *            callback returns, as a periodic timer.
+     */
+    void reschedule(handle_type h, tick_type delay)
+    {
+        if (h->slot != no_slot) {
+            unlink(h);
+        } else {
+            ++size_;  // the running timer comes back
+        }
+        h->expiry = deadline(delay);
+        insert(h, now_ + 1);
+    }
+
+    /**
+     * @brief Advance the current tick by 'ticks', calling f(value) with a value_type& for every
+     *        timer expiring on the way, tick by tick. A timer is no longer pending while f runs.
+     *
+     * @attention The timers of one tick expire as a batch, in no particular order. 'f' may
+     *            schedule, reschedule or cancel timers, including its own and the ones of the
+     *            same batch not run yet, or clear() the wheel; now() is the tick of the batch.
+     * @attention Should 'f' throw, the current tick stays the one of the batch, whose timers not
+     *            run yet are moved to the next tick.
+     * @return Number of timers run
+     */
+    template<typename Function>
+    size_type advance(tick_type ticks, Function f)
+    {
+        const tick_type target = now_ + ticks;
+        size_type count = 0;
+        while (now_ != target) {
+            if (size_ == 0) {
+                now_ = target;
+                break;
+            }
+            const tick_type t = next_event();
+            if (t - now_ > target - now_) {
+                now_ = target;
+                break;
+            }
+            now_ = t;
+            cascade(t);
+            count += expire(t, f);
+        }
+        return count;
+    }
+
+    /**
+     * @brief Cancel every pending timer, including the rest of a batch being expired when called
+     *        from advance(). The current tick stays.
+     */
+    void clear()
+    {
+        for (size_type s = 0; s < levels * slots_per_level; ++s) {
+            drain(slots_[s]);
+        }
+        for (batch_link* batch = batch_; batch; batch = batch->outer) {
+            drain(*batch);
+        }
+        for (uint64_t& bits : nonempty_) {
+            bits = 0;
+        }
+        size_ = 0;
+    }
+
+protected:  // internal methods
+    tick_type deadline(tick_type delay) const { return now_ + (delay != 0 ? delay : 1); }
+
+    // Slot of tick 't' at 'level': bits [6 level, 6 level + 6) of 't'
+    static size_type slot_index(size_type level, tick_type t)
+    {
+        return size_type(t >> (level * slot_bits)) & (slots_per_level - 1);
+    }
+
+    void destroy_node(timer_node* node)
+    {
+        mem::destroy(node);
+        node_allocator::deallocate(node);
+    }
+
+    // Destroy the timers of the list headed by 'head', leaving it empty. A running timer
+    // rescheduled by its callback is only taken out: expire() destroys it.
+    void drain(link& head)
+    {
+        while (head.next != &head) {
+            timer_node* node = static_cast<timer_node*>(head.next);
+            head.next = node->next;
+            if (node->running) {
+                node->slot = no_slot;
+            } else {
+                destroy_node(node);
+            }
+        }
+        head.prev = &head;
+    }
+
+    // Link 'node' in the slot of its expiry, relative to tick 'base', the next one to process.
+    // The expiry must not come before 'base'.
+    void insert(timer_node* node, tick_type base)
+    {
+        const tick_type delta = node->expiry - base;
+        // level: 'delta' fits in 6 (L + 1) bits, slot: bits [6L, 6L + 6) of the expiry
+        const size_type level = delta == 0 ? 0 : size_type(63 - __builtin_clzll(delta)) / slot_bits;
+        const size_type index = slot_index(level, node->expiry);
+        node->slot = level * slots_per_level + index;
+        link& head = slots_[node->slot];
+        node->prev = head.prev;
+        node->next = &head;
+        head.prev->next = node;
+        head.prev = node;
+        nonempty_[level] |= uint64_t(1) << index;
+    }
+
+    void unlink(timer_node* node)
+    {
+        node->prev->next = node->next;
+        node->next->prev = node->prev;
+        // the node may sit in a batch being expired: test the slot itself
+        link& head = slots_[node->slot];
+        if (head.next == &head) {
+            const size_type level = node->slot / slots_per_level;
+            nonempty_[level] &= ~(uint64_t(1) << (node->slot % slots_per_level));
+        }
+    }
+
+    // Move the timers of the slot of tick 't' at 'level' out to a list headed by 'batch'
+    void detach(size_type level, tick_type t, link& batch)
+    {
+        const size_type index = slot_index(level, t);
+        link& head = slots_[level * slots_per_level + index];
+        if (head.next == &head) {
+            batch.prev = batch.next = &batch;
+            return;
+        }
+        batch.next = head.next;
+        batch.prev = head.prev;
+        batch.next->prev = &batch;
+        batch.prev->next = &batch;
+        head.prev = head.next = &head;
+        nonempty_[level] &= ~(uint64_t(1) << index);
+    }
+
+    // First tick after now_ at which a nonempty slot expires or cascades
+    tick_type next_event() const
+    {
+        tick_type best = ~tick_type(0);
+        for (size_type level = 0; level < levels; ++level) {
+            const uint64_t bits = nonempty_[level];
+            if (bits == 0) {
+                continue;
+            }
+            const size_type shift = level * slot_bits;
+            // first tick after now_ whose bits below this level are all 0: the slots of the
+            // level are visited from there, one every 2^shift ticks
+            const tick_type first = level == 0 ? now_ + 1 : ((now_ >> shift) + 1) << shift;
+            const size_type index = slot_index(level, first);
+            const uint64_t rotated = (bits >> index) | (bits << ((slots_per_level - index) & 63));
+            const tick_type steps = tick_type(__builtin_ctzll(rotated));
+            const tick_type t = first + (steps << shift);
+            if (t > now_ && t < best) {  // past the end of the tick range otherwise
+                best = t;
+            }
+        }
+        return best;
+    }
+
+    // At tick 't', move down the timers of the slots whose lower levels all rolled over
+    void cascade(tick_type t)
+    {
+        for (size_type level = 1; level < levels; ++level) {
+            if (slot_index(level - 1, t) != 0) {
+                break;
+            }
+            link batch;
+            detach(level, t, batch);
+            while (batch.next != &batch) {
+                timer_node* node = static_cast<timer_node*>(batch.next);
+                batch.next = node->next;
+                insert(node, t);  // before the level 0 slot of 't' expires
+            }
+        }
+    }
+
+    // Run the timers of the level 0 slot of tick 't'. The batch is published in 'batch_' while
+    // the callbacks run, for clear() to reach it.
+    template<typename Function>
+    size_type expire(tick_type t, Function& f)
+    {
+        batch_link batch;
+        detach(0, t, batch);
+        batch.outer = batch_;
+        batch_ = &batch;
+        size_type count = 0;
+        while (batch.next != &batch) {
+            timer_node* node = static_cast<timer_node*>(batch.next);
+            node->prev->next = node->next;
+            node->next->prev = node->prev;
+            node->slot = no_slot;
+            node->running = true;
+            --size_;
+            try {
+                f(node->value);
+            } catch (...) {
+                retire(node);
+                requeue(batch);
+                batch_ = batch.outer;
+                throw;
+            }
+            retire(node);
+            ++count;
+        }
+        batch_ = batch.outer;
+        return count;
+    }
+
+    // After its callback, destroy a timer unless the callback rescheduled it
+    void retire(timer_node* node)
+    {
+        node->running = false;
+        if (node->slot == no_slot) {
+            destroy_node(node);
+        }
+    }
+
+    // Put back the timers of a batch interrupted by an exception: they expire at the next tick
+    void requeue(link& batch)
+    {
+        while (batch.next != &batch) {
+            timer_node* node = static_cast<timer_node*>(batch.next);
+            batch.next = node->next;
+            batch.next->prev = &batch;
+            node->expiry = now_ + 1;
+            insert(node, now_ + 1);
+        }
+    }
+
+protected:
+    link slots_[levels * slots_per_level];  // list heads, level by level
+    uint64_t nonempty_[levels];             // bit i of level L set when its slot i is nonempty
+    batch_link* batch_;                     // innermost batch being expired, or null
+    tick_type now_;                         // current tick
+    size_type size_;                        // number of pending timers
+};
+
+}  // namespace mini::ctnr
+
+#endif
@@ -0,0 +1,338 @@
+#ifndef MINI_CONTAINER_CIRCULAR_BUFFER_H
+#define MINI_CONTAINER_CIRCULAR_BUFFER_H
+
+#include "mini_stl/algorithm/mini_algorithm.h"
+#include "mini_stl/memory/mini_memory.h"
+
+#include "mini_stl/iterator/mini_iterator_circular_buffer.h"
+
+#include <stdexcept>
+#include <utility>
+
+namespace mini::ctnr {
+
+/**
+ * @brief Ring buffer over one contiguous power-of-two array.
+ *
+ * @attention The capacity is always a power of two, a slot is located with a mask.
+ * @attention When full, a push either overwrites the element at the opposite end (overwrite
+ *            mode, for fixed windows) or doubles the capacity (default, so that the container
+ *            can back an unbounded queue or stack). A buffer of capacity 0 always grows.
+ * @attention The elements occupy at most two contiguous runs of the array, exposed by
+ *            array_one() and array_two() for batched memcpy-style transfers.
+ * @tparam T value type
+ * @tparam Allocator 1st level allocator or sub-allocator
+ */
+template<typename T, typename Allocator = mem::alloc>
+class circular_buffer {
+public:  // public typedefs
+    typedef T value_type;
+    typedef value_type& reference;
+    typedef const value_type& const_reference;
+    typedef value_type* pointer;
+    typedef const value_type* const_pointer;
+    typedef size_t size_type;
+    typedef ptrdiff_t difference_type;
+    typedef iter::__circular_buffer_iterator<T, T&, T*> iterator;
+    typedef iter::__circular_buffer_iterator<T, const T&, const T*> const_iterator;
+
+    // a contiguous run of elements: start and length
+    typedef std::pair<pointer, size_type> array_range;
+    typedef std::pair<const_pointer, size_type> const_array_range;
+
+protected:  // internal typedefs
+    typedef circular_buffer<T, Allocator> self;
+    typedef mem::simple_alloc<value_type, Allocator> data_allocator;
+
+public:
+    /**
+     * @param capacity Minimum capacity, rounded up to a power of two
+     * @param overwrite Overwrite the element at the opposite end instead of growing when full
+     */
+    explicit circular_buffer(size_type capacity = 0, bool overwrite = false)
+        : buf_(0)
+        , capacity_(0)
+        , head_(0)
+        , tail_(0)
+        , overwrite_(overwrite)
+    {
+        reserve(capacity);
+    }
+
+    circular_buffer(const self& other)
+        : circular_buffer(other.capacity_, other.overwrite_)
+    {
+        const_array_range one = other.array_one();
+        const_array_range two = other.array_two();
+        mem::uninitialized_copy(two.first, two.first + two.second,
+            mem::uninitialized_copy(one.first, one.first + one.second, buf_));
+        tail_ = other.size();
+    }
+
+    circular_buffer(self&& other) noexcept
+        : circular_buffer()
+    {
+        swap(other);
+    }
+
+    self& operator=(self other)
+    {
+        swap(other);
+        return *this;
+    }
+
+    ~circular_buffer()
+    {
+        clear();
+        if (buf_) {
+            data_allocator::deallocate(buf_, capacity_);
+        }
+    }
+
+public:
+    // Iterators
+
+    iterator begin() { return iterator(buf_, mask(), head_); }
+
+    const_iterator begin() const { return const_iterator(buf_, mask(), head_); }
+
+    iterator end() { return iterator(buf_, mask(), tail_); }
+
+    const_iterator end() const { return const_iterator(buf_, mask(), tail_); }
+
+    // Element access
+
+    reference operator[](size_type n) { return buf_[(head_ + n) & mask()]; }
+
+    const_reference operator[](size_type n) const { return buf_[(head_ + n) & mask()]; }
+
+    reference at(size_type n)
+    {
+        if (n >= size()) {
+            throw std::out_of_range(
+                "mini::ctnr::circular_buffer: out_of_range failure: n >= size()");
+        }
+        return (*this)[n];
+    }
+
+    reference front() { return buf_[head_ & mask()]; }
+
+    const_reference front() const { return buf_[head_ & mask()]; }
+
+    reference back() { return buf_[(tail_ - 1) & mask()]; }
+
+    const_reference back() const { return buf_[(tail_ - 1) & mask()]; }
+
+    /**
+     * @brief First contiguous run of elements, starting at front().
+     */
+    array_range array_one() { return array_range(buf_ + (head_ & mask()), first_run()); }
+
+    const_array_range array_one() const
+    {
+        return const_array_range(buf_ + (head_ & mask()), first_run());
+    }
+
+    /**
+     * @brief Second contiguous run of elements, starting at the beginning of the storage.
+     *        Empty unless the elements wrap around the end of the storage.
+     */
+    array_range array_two() { return array_range(buf_, size() - first_run()); }
+
+    const_array_range array_two() const { return const_array_range(buf_, size() - first_run()); }
+
+    // Capacity
+
+    size_type size() const { return tail_ - head_; }
+
+    size_type capacity() const { return capacity_; }
+
+    size_type max_size() const { return size_type(-1) / 2 + 1; }
+
+    bool empty() const { return head_ == tail_; }
+
+    bool full() const { return size() == capacity_; }
+
+    bool overwrite() const { return overwrite_; }
+
+    void set_overwrite(bool overwrite) { overwrite_ = overwrite; }
+
+    /**
+     * @brief Grow the capacity to at least 'new_cap', rounded up to a power of two.
+     */
+    void reserve(size_type new_cap)
+    {
+        if (new_cap > capacity_) {
+            reallocate(round_up(new_cap));
+        }
+    }
+
+    // Modifiers
+
+    template<typename... Args>
+    reference emplace_back(Args&&... args)
+    {
+        if (full()) {
+            if (overwrite_ && capacity_ != 0) {
+                // the new back takes the slot of the oldest element
+                buf_[head_ & mask()] = value_type(std::forward<Args>(args)...);
+                ++head_;
+                ++tail_;
+                return back();
+            }
+            // 'args' may refer to an element: build the value before the storage moves
+            value_type x(std::forward<Args>(args)...);
+            reallocate(grow_capacity());
+            mem::construct(buf_ + (tail_ & mask()), std::move(x));
+        } else {
+            mem::construct(buf_ + (tail_ & mask()), std::forward<Args>(args)...);
+        }
+        ++tail_;
+        return back();
+    }
+
+    template<typename... Args>
+    reference emplace_front(Args&&... args)
+    {
+        if (full()) {
+            if (overwrite_ && capacity_ != 0) {
+                // the new front takes the slot of the newest element
+                buf_[(tail_ - 1) & mask()] = value_type(std::forward<Args>(args)...);
+                --head_;
+                --tail_;
+                return front();
+            }
+            value_type x(std::forward<Args>(args)...);
+            reallocate(grow_capacity());
+            mem::construct(buf_ + ((head_ - 1) & mask()), std::move(x));
+        } else {
+            mem::construct(buf_ + ((head_ - 1) & mask()), std::forward<Args>(args)...);
+        }
+        --head_;
+        return front();
+    }
+
+    void push_back(const_reference value) { emplace_back(value); }
+
+    void push_back(value_type&& value) { emplace_back(std::move(value)); }
+
+    void push_front(const_reference value) { emplace_front(value); }
+
+    void push_front(value_type&& value) { emplace_front(std::move(value)); }
+
+    void pop_back()
+    {
+        --tail_;
+        mem::destroy(buf_ + (tail_ & mask()));
+    }
+
+    void pop_front()
+    {
+        mem::destroy(buf_ + (head_ & mask()));
+        ++head_;
+    }
+
+    /**
+     * @brief Remove the first n elements, e.g. after consuming array_one().
+     */
+    void erase_begin(size_type n)
+    {
+        destroy_range(head_, head_ + n);
+        head_ += n;
+    }
+
+    /**
+     * @brief Remove the last n elements.
+     */
+    void erase_end(size_type n)
+    {
+        destroy_range(tail_ - n, tail_);
+        tail_ -= n;
+    }
+
+    void clear() { erase_begin(size()); }
+
+    void swap(self& other) noexcept
+    {
+        std::swap(buf_, other.buf_);
+        std::swap(capacity_, other.capacity_);
+        std::swap(head_, other.head_);
+        std::swap(tail_, other.tail_);
+        std::swap(overwrite_, other.overwrite_);
+    }
+
+protected:  // internal methods
+    size_type mask() const { return capacity_ - 1; }
+
+    // number of elements from front() to the end of the storage (or to back())
+    size_type first_run() const
+    {
+        const size_type to_end = capacity_ - (head_ & mask());
+        return size() < to_end ? size() : to_end;
+    }
+
+    size_type grow_capacity() const { return capacity_ != 0 ? capacity_ * 2 : 1; }
+
+    static size_type round_up(size_type n)
+    {
+        size_type cap = 1;
+        while (cap < n) {
+            cap <<= 1;
+        }
+        return cap;
+    }
+
+    // destroy elements of logical index range [first, last), one contiguous run at a time
+    void destroy_range(size_type first, size_type last)
+    {
+        if (first == last) {
+            return;
+        }
+        pointer p = buf_ + (first & mask());
+        const size_type n = last - first;
+        const size_type to_end = capacity_ - (first & mask());
+        if (n <= to_end) {
+            mem::destroy(p, p + n);
+        } else {
+            mem::destroy(p, buf_ + capacity_);
+            mem::destroy(buf_, buf_ + (n - to_end));
+        }
+    }
+
+    // Move elements to a new storage of 'new_cap' slots, front() lands at slot 0
+    void reallocate(size_type new_cap)
+    {
+        pointer new_buf = data_allocator::allocate(new_cap);
+        const size_type n = size();
+        if (n != 0) {
+            array_range one = array_one();
+            array_range two = array_two();
+            try {
+                mem::uninitialized_move(two.first, two.first + two.second,
+                    mem::uninitialized_move(one.first, one.first + one.second, new_buf));
+            } catch (...) {
+                data_allocator::deallocate(new_buf, new_cap);
+                throw;
+            }
+            clear();
+        }
+        if (buf_) {
+            data_allocator::deallocate(buf_, capacity_);
+        }
+        buf_ = new_buf;
+        capacity_ = new_cap;
+        head_ = 0;
+        tail_ = n;
+    }
+
+protected:
+    pointer buf_;         // storage, 'capacity_' slots
+    size_type capacity_;  // number of slots, 0 or a power of two
+    size_type head_;      // logical index of front(), slot is (head_ & mask())
+    size_type tail_;      // logical index one past back()
+    bool overwrite_;      // overwrite instead of growing when full
+};
+
+}  // namespace mini::ctnr
+
+#endif
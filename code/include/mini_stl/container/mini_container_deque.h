@@ -10,7 +10,21 @@
 
 namespace mini::ctnr {
 
-template<typename T, typename Allocator = mem::alloc, size_t BufferSize = 0>
+/**
+ * @brief Double-ended queue: a map of fixed-size buffers.
+ *
+ * @tparam T value type
+ * @tparam Allocator 1st level allocator or sub-allocator
+ * @tparam BufferSize Elements per buffer, 0 lets BufferPolicy decide
+ * @tparam BufferPolicy Buffer sizing policy, see iter::deque_buffer_policy. A power-of-two policy
+ *                      turns random access into shift/mask arithmetic.
+ * @attention Buffers emptied at either end are kept in a small reserve (see
+ *            BufferPolicy::spare_buffers) and reused by the next push that needs a buffer, and the
+ *            map is recentered rather than grown while it is at most half full, so a steady-state
+ *            FIFO does no allocation.
+ */
+template<typename T, typename Allocator = mem::alloc, size_t BufferSize = 0,
+    typename BufferPolicy = iter::deque_buffer_policy<>>
 class deque {
 public:  // public typedefs
     typedef T value_type;
@@ -19,23 +33,71 @@ public:  // public typedefs
     typedef value_type* pointer;
     typedef size_t size_type;
     typedef ptrdiff_t difference_type;
-    typedef iter::__deque_iterator<T, T&, T*, BufferSize> iterator;
+    typedef iter::__deque_iterator<T, T&, T*, BufferSize, BufferPolicy> iterator;
 
 protected:  // internal typedefs
     typedef pointer* map_pointer;
     typedef mem::simple_alloc<value_type, Allocator> data_allocator;
     typedef mem::simple_alloc<pointer, Allocator> map_allocator;
 
+    typedef deque<T, Allocator, BufferSize, BufferPolicy> self;
+
+    static constexpr size_type max_spare_nodes = BufferPolicy::spare_buffers;
+
 public:
-    deque(int n = 0, const_reference value = value_type{})
+    deque()
+        : begin_()
+        , end_()
+        , map_(0)
+        , map_size_(0)
+        , num_spare_nodes_(0)
+    {
+        create_map_and_nodes(0);
+    }
+
+    explicit deque(int n, const_reference value = value_type{})
         : begin_()
         , end_()
         , map_(0)
         , map_size_(0)
+        , num_spare_nodes_(0)
     {
         fill_initialize(n, value);
     }
 
+    deque(const self& other)
+        : begin_()
+        , end_()
+        , map_(0)
+        , map_size_(0)
+        , num_spare_nodes_(0)
+    {
+        create_map_and_nodes(other.size());
+        try {
+            mem::uninitialized_copy(other.begin_, other.end_, begin_);
+        } catch (...) {
+            destroy_map_and_nodes();
+            throw;
+        }
+    }
+
+    self& operator=(const self& other)
+    {
+        if (this != &other) {
+            self tmp(other);
+            swap(tmp);
+        }
+        return *this;
+    }
+
+    ~deque()
+    {
+        if (map_) {
+            clear();
+            destroy_map_and_nodes();
+        }
+    }
+
 public:
     // Iterators
     iterator begin() const { return begin_; }
@@ -60,28 +122,40 @@ public:
     bool empty() const { return begin_ == end_; }
 
     // Modifiers
-    void push_back(const_reference value)
+    template<typename... Args>
+    reference emplace_back(Args&&... args)
     {
         if (end_.cur != (end_.last - 1)) {
-            mem::construct(end_.cur, value);
+            mem::construct(end_.cur, std::forward<Args>(args)...);
             ++end_.cur;
         } else {
             // remaining space have only one space left or none
-            push_back_aux(value);
+            emplace_back_aux(std::forward<Args>(args)...);
         }
+        return back();
     }
 
-    void push_front(const_reference value)
+    template<typename... Args>
+    reference emplace_front(Args&&... args)
     {
         if (begin_.cur != begin_.first) {  // still have one or more space left
-            mem::construct(begin_.cur - 1, value);
+            mem::construct(begin_.cur - 1, std::forward<Args>(args)...);
             --begin_.cur;
         } else {
             // there is no space left
-            push_front_aux(value);
+            emplace_front_aux(std::forward<Args>(args)...);
         }
+        return front();
     }
 
+    void push_back(const_reference value) { emplace_back(value); }
+
+    void push_back(value_type&& value) { emplace_back(std::move(value)); }
+
+    void push_front(const_reference value) { emplace_front(value); }
+
+    void push_front(value_type&& value) { emplace_front(std::move(value)); }
+
     void pop_back()
     {
         if (end_.cur != end_.first) {  // have one or more elements
@@ -115,14 +189,14 @@ public:
         // notes: buffer zones except head and tail buffer zone must be full
         for (map_pointer node = begin_.node + 1; node < end_.node; ++node) {
             mem::destroy(*node, *node + buffer_size());
-            data_allocator::deallocate(*node, buffer_size());
+            deallocate_node(*node);
         }
 
         if (begin_.node != end_.node) {  // if have 2 buffer zones (head and tail)
             mem::destroy(begin_.cur, begin_.last);
             mem::destroy(end_.first, end_.cur);
             // only deallocate tail buffer zone
-            data_allocator::deallocate(end_.first, buffer_size());
+            deallocate_node(end_.first);
         } else {                                 // if only have one buffer zone
             mem::destroy(begin_.cur, end_.cur);  // destroy all elements within this buffer
         }
@@ -143,10 +217,10 @@ public:
         difference_type idx = pos - begin_;
         if (idx < (size() >> 1)) {  // equivalent to size() / 2
             // fewer elements before the removal point
-            algo::copy_backward(begin_, pos, next);  // copy elements backward
+            algo::move_backward(begin_, pos, next);  // move elements backward
             pop_front();                             // remove the first element
         } else {
-            algo::copy(next, end_, pos);
+            algo::move(next, end_, pos);
             pop_back();
         }
         return begin_ + idx;
@@ -171,21 +245,21 @@ public:
         difference_type elements_before = first - begin_;  // num elements before erase interval
         if (elements_before < (size() - n) / 2) {
             // elements before erase point is fewer, move elements at front backward
-            algo::copy_backward(begin_, first, last);
+            algo::move_backward(begin_, first, last);
             iterator new_begin = begin_ + n;
             mem::destroy(begin_, new_begin);
             // free redundant buffer space at the front after the movement
             for (map_pointer cur_node = begin_.node; cur_node < new_begin.node; ++cur_node) {
-                data_allocator::deallocate(*cur_node, buffer_size());
+                deallocate_node(*cur_node);
             }
             begin_ = new_begin;  // new begin point of deque
         } else {
             // elements after erase point is fewer, move elements at the back to front
-            algo::copy(last, end_, first);
+            algo::move(last, end_, first);
             iterator new_end = end_ - n;
             mem::destroy(new_end, end_);
             for (map_pointer cur_node = new_end.node + 1; cur_node <= end_.node; ++cur_node) {
-                data_allocator::deallocate(*cur_node, buffer_size());
+                deallocate_node(*cur_node);
             }
             end_ = new_end;
         }
@@ -193,28 +267,94 @@ public:
     }
 
     /**
-     * @brief Insert an element at a position.
+     * @brief Construct an element in place at a position.
      *
      * @param pos Position to insert
-     * @param value Value of element to insert
+     * @param args Arguments forwarded to the constructor of the element
      * @return iterator Inserted position
      */
-    iterator insert(iterator pos, const_reference value)
+    template<typename... Args>
+    iterator emplace(iterator pos, Args&&... args)
     {
-        if (pos == begin_) {
-            // insert point is the front, call push_front()
-            push_front(value);
+        if (pos.cur == begin_.cur) {
+            // insert point is the front, call emplace_front()
+            emplace_front(std::forward<Args>(args)...);
             return begin_;
-        } else if (pos == end_) {
-            // if insert point is the back, call push_back()
-            push_back(value);
+        } else if (pos.cur == end_.cur) {
+            // if insert point is the back, call emplace_back()
+            emplace_back(std::forward<Args>(args)...);
             return end_ - 1;
         } else {
             // insert point at middle
-            return insert_aux(pos, value);
+            return emplace_aux(pos, std::forward<Args>(args)...);
         }
     }
 
+    /**
+     * @brief Insert an element at a position.
+     *
+     * @param pos Position to insert
+     * @param value Value of element to insert
+     * @return iterator Inserted position
+     */
+    iterator insert(iterator pos, const_reference value) { return emplace(pos, value); }
+
+    iterator insert(iterator pos, value_type&& value) { return emplace(pos, std::move(value)); }
+
+    /**
+     * @brief Insert a range of elements at a position.
+     *
+     * @attention With forward iterators the room for all new elements is reserved first and the
+     *            elements on the shorter side of 'pos' are shifted once, by the whole distance.
+     * @param pos Position to insert
+     * @param first Start of range to insert
+     * @param last End of range to insert
+     * @return iterator Position of the first inserted element
+     */
+    template<typename InputIterator>
+    iterator insert(iterator pos, InputIterator first, InputIterator last)
+    {
+        return range_insert(pos, first, last, iter::iterator_category(first));
+    }
+
+    /**
+     * @brief Resize the container to contain 'new_size' elements.
+     *
+     * @param new_size New number of elements
+     * @param value Value of appended elements if the container grows
+     */
+    void resize(size_type new_size, const_reference value = value_type())
+    {
+        const size_type len = size();
+        if (new_size < len) {
+            erase(begin_ + difference_type(new_size), end_);
+        } else if (new_size > len) {
+            iterator new_end = reserve_elements_at_back(new_size - len);
+            try {
+                mem::uninitialized_fill(end_, new_end, value);
+            } catch (...) {
+                destroy_nodes_after(end_.node, new_end.node);
+                throw;
+            }
+            end_ = new_end;
+        }
+    }
+
+    /**
+     * @brief Free the buffers kept in reserve for reuse.
+     */
+    void shrink_to_fit() { release_spare_nodes(); }
+
+    void swap(self& other)
+    {
+        std::swap(begin_, other.begin_);
+        std::swap(end_, other.end_);
+        std::swap(map_, other.map_);
+        std::swap(map_size_, other.map_size_);
+        std::swap(spare_nodes_, other.spare_nodes_);
+        std::swap(num_spare_nodes_, other.num_spare_nodes_);
+    }
+
     std::string dump()
     {
         std::stringstream ss;
@@ -233,7 +373,7 @@ public:
     }
 
 protected:  // internal methods
-    size_type buffer_size() { return iterator::buffer_size(); }
+    static constexpr size_type buffer_size() { return iterator::buffer_size(); }
 
     void fill_initialize(size_type n, const_reference value)
     {
@@ -289,7 +429,8 @@ protected:  // internal methods
         end_.cur = end_.first + num_elements % buffer_size();
     }
 
-    void push_back_aux(const_reference value)
+    template<typename... Args>
+    void emplace_back_aux(Args&&... args)
     {
         // 1. allocate a new buffer
         // 2. construct new element
@@ -300,7 +441,7 @@ protected:  // internal methods
         // allocate a node (buffer) at the back of current buffer
         *(end_.node + 1) = allocate_node();
         try {
-            mem::construct(end_.cur, value);  // this step likely to fail
+            mem::construct(end_.cur, std::forward<Args>(args)...);  // this step likely to fail
             end_.set_node(end_.node + 1);
             end_.cur = end_.first;
         } catch (const std::exception& e) {
@@ -311,7 +452,8 @@ protected:  // internal methods
         }
     }
 
-    void push_front_aux(const_reference value)
+    template<typename... Args>
+    void emplace_front_aux(Args&&... args)
     {
         reserve_map_at_front();
         *(begin_.node - 1) = allocate_node();
@@ -319,7 +461,8 @@ protected:  // internal methods
         try {
             begin_.set_node(begin_.node - 1);
             begin_.cur = begin_.last - 1;
-            mem::construct(begin_.cur, value);  // construct element at tail of front buffer
+            // construct element at tail of front buffer
+            mem::construct(begin_.cur, std::forward<Args>(args)...);
         } catch (const std::exception& e) {
             // rollback: reset begin_ iterator, deallocate the node
             begin_.set_node(begin_.node + 1);
@@ -347,28 +490,223 @@ protected:  // internal methods
         begin_.cur = begin_.first;
     }
 
-    iterator insert_aux(iterator pos, const_reference value)
+    template<typename... Args>
+    iterator emplace_aux(iterator pos, Args&&... args)
     {
+        // build the element first: 'args' may refer to an element that is about to be shifted
+        value_type x(std::forward<Args>(args)...);
         difference_type idx = pos - begin_;  // number of elements before insert point
-        if (idx < size() / 2) {
+        if (size_type(idx) < size() / 2) {
             // number of elements before insert point is fewer: shift elements frontwards
-            push_front(front());  // allocate map node/buffer under the hood if necessary
-
-            // TODO: Verity correctness
+            emplace_front(std::move(front()));  // may allocate map node/buffer under the hood
+            // the map may have been reallocated: recompute positions from begin_
+            pos = begin_ + idx;
             // shift original interval: [2nd element, insertion point) one slot forward
-            algo::copy(begin_ + 2, pos, begin_ + 1);
+            algo::move(begin_ + 2, pos + 1, begin_ + 1);
         } else {
             // number of elements after insert point is fewer: shift elements backward
-            push_back(back());  // allocate map node/buffer under the hood if necessary
-
-            // TODO: Verity correctness
+            emplace_back(std::move(back()));  // may allocate map node/buffer under the hood
+            pos = begin_ + idx;
             // shift original interval: [insertion point, 2nd last element + 1) one slot backward
-            algo::copy_backward(pos, end_ - 2, end_ - 1);
+            algo::move_backward(pos, end_ - 2, end_ - 1);
         }
-        *pos = value;
+        *pos = std::move(x);
         return pos;
     }
 
+    template<typename InputIterator>
+    iterator range_insert(
+        iterator pos, InputIterator first, InputIterator last, iter::input_iterator_tag)
+    {
+        // single pass: insert one by one
+        difference_type idx = pos - begin_;
+        for (iterator cur = pos; first != last; ++first, ++cur) {
+            cur = emplace(cur, *first);
+        }
+        return begin_ + idx;
+    }
+
+    template<typename ForwardIterator>
+    iterator range_insert(
+        iterator pos, ForwardIterator first, ForwardIterator last, iter::forward_iterator_tag)
+    {
+        const difference_type idx = pos - begin_;
+        const size_type n = size_type(iter::distance(first, last));
+        if (n == 0) {
+            return pos;
+        }
+        if (pos.cur == begin_.cur) {
+            iterator new_begin = reserve_elements_at_front(n);
+            try {
+                mem::uninitialized_copy(first, last, new_begin);
+            } catch (...) {
+                destroy_nodes_before(new_begin.node, begin_.node);
+                throw;
+            }
+            begin_ = new_begin;
+        } else if (pos.cur == end_.cur) {
+            iterator new_end = reserve_elements_at_back(n);
+            try {
+                mem::uninitialized_copy(first, last, end_);
+            } catch (...) {
+                destroy_nodes_after(end_.node, new_end.node);
+                throw;
+            }
+            end_ = new_end;
+        } else if (size_type(idx) < size() / 2) {
+            insert_range_at_front_side(idx, first, last, n);
+        } else {
+            insert_range_at_back_side(idx, first, last, n);
+        }
+        return begin_ + idx;
+    }
+
+    // Insert n elements 'idx' slots after begin_ by moving the first 'idx' elements n slots toward
+    // the front. Slots [new_begin, begin_) are raw, slots from begin_ on hold elements.
+    template<typename ForwardIterator>
+    void insert_range_at_front_side(
+        difference_type idx, ForwardIterator first, ForwardIterator last, size_type n)
+    {
+        iterator new_begin = reserve_elements_at_front(n);
+        iterator old_begin = begin_;
+        iterator pos = begin_ + idx;
+        try {
+            if (size_type(idx) >= n) {
+                iterator begin_n = begin_ + difference_type(n);
+                mem::uninitialized_move(begin_, begin_n, new_begin);
+                begin_ = new_begin;
+                algo::move(begin_n, pos, old_begin);
+                algo::copy(first, last, pos - difference_type(n));
+            } else {
+                ForwardIterator mid = first;
+                iter::advance(mid, difference_type(n) - idx);
+                iterator raw_mid = mem::uninitialized_move(begin_, pos, new_begin);
+                try {
+                    mem::uninitialized_copy(first, mid, raw_mid);
+                } catch (...) {
+                    mem::destroy(new_begin, raw_mid);
+                    throw;
+                }
+                begin_ = new_begin;
+                algo::copy(mid, last, old_begin);
+            }
+        } catch (...) {
+            if (begin_.cur != new_begin.cur) {  // reserved buffers are not in use yet
+                destroy_nodes_before(new_begin.node, begin_.node);
+            }
+            throw;
+        }
+    }
+
+    // Insert n elements 'idx' slots after begin_ by moving the elements after them n slots toward
+    // the back. Slots [end_, new_end) are raw.
+    template<typename ForwardIterator>
+    void insert_range_at_back_side(
+        difference_type idx, ForwardIterator first, ForwardIterator last, size_type n)
+    {
+        iterator new_end = reserve_elements_at_back(n);
+        iterator old_end = end_;
+        iterator pos = begin_ + idx;
+        const difference_type elements_after = difference_type(size()) - idx;
+        try {
+            if (elements_after > difference_type(n)) {
+                iterator end_n = end_ - difference_type(n);
+                mem::uninitialized_move(end_n, end_, end_);
+                end_ = new_end;
+                algo::move_backward(pos, end_n, old_end);
+                algo::copy(first, last, pos);
+            } else {
+                ForwardIterator mid = first;
+                iter::advance(mid, elements_after);
+                iterator raw_mid = mem::uninitialized_copy(mid, last, end_);
+                try {
+                    mem::uninitialized_move(pos, end_, raw_mid);
+                } catch (...) {
+                    mem::destroy(end_, raw_mid);
+                    throw;
+                }
+                end_ = new_end;
+                algo::copy(first, mid, pos);
+            }
+        } catch (...) {
+            if (end_.cur != new_end.cur) {  // reserved buffers are not in use yet
+                destroy_nodes_after(end_.node, new_end.node);
+            }
+            throw;
+        }
+    }
+
+    // Make sure buffers exist for n more elements before begin_, return the would-be new begin_
+    iterator reserve_elements_at_front(size_type n)
+    {
+        size_type vacancies = begin_.cur - begin_.first;
+        if (n > vacancies) {
+            new_elements_at_front(n - vacancies);
+        }
+        return begin_ - difference_type(n);
+    }
+
+    // Make sure buffers exist for n more elements after end_, return the would-be new end_
+    iterator reserve_elements_at_back(size_type n)
+    {
+        // end_.cur must always point into a buffer, hence one slot is not a vacancy
+        size_type vacancies = (end_.last - end_.cur) - 1;
+        if (n > vacancies) {
+            new_elements_at_back(n - vacancies);
+        }
+        return end_ + difference_type(n);
+    }
+
+    void new_elements_at_front(size_type new_elements)
+    {
+        size_type new_nodes = (new_elements + buffer_size() - 1) / buffer_size();
+        reserve_map_at_front(new_nodes);
+        size_type i = 1;
+        try {
+            for (; i <= new_nodes; ++i) {
+                *(begin_.node - i) = allocate_node();
+            }
+        } catch (...) {
+            for (size_type j = 1; j < i; ++j) {
+                deallocate_node(*(begin_.node - j));
+            }
+            throw;
+        }
+    }
+
+    void new_elements_at_back(size_type new_elements)
+    {
+        size_type new_nodes = (new_elements + buffer_size() - 1) / buffer_size();
+        reserve_map_at_back(new_nodes);
+        size_type i = 1;
+        try {
+            for (; i <= new_nodes; ++i) {
+                *(end_.node + i) = allocate_node();
+            }
+        } catch (...) {
+            for (size_type j = 1; j < i; ++j) {
+                deallocate_node(*(end_.node + j));
+            }
+            throw;
+        }
+    }
+
+    // Release buffers reserved in [first, last) of the map (front side, not in use)
+    void destroy_nodes_before(map_pointer first, map_pointer last)
+    {
+        for (; first < last; ++first) {
+            deallocate_node(*first);
+        }
+    }
+
+    // Release buffers reserved in (first, last] of the map (back side, not in use)
+    void destroy_nodes_after(map_pointer first, map_pointer last)
+    {
+        for (++first; first <= last; ++first) {
+            deallocate_node(*first);
+        }
+    }
+
     void reserve_map_at_back(size_type nodes_to_add = 1)
     {
         if (nodes_to_add > (map_size_ - (end_.node - map_) - 1)) {
@@ -416,9 +754,43 @@ protected:  // internal methods
         end_.set_node(new_nbegin + old_num_nodes - 1);
     }
 
-    pointer allocate_node() { return data_allocator::allocate(buffer_size()); }
+    // Take a buffer from the spare reserve, or allocate one if the reserve is empty
+    pointer allocate_node()
+    {
+        if (num_spare_nodes_ != 0) {
+            return spare_nodes_[--num_spare_nodes_];
+        }
+        return data_allocator::allocate(buffer_size());
+    }
+
+    // Keep an emptied buffer in the spare reserve, or free it if the reserve is full
+    void deallocate_node(pointer p)
+    {
+        if (num_spare_nodes_ < max_spare_nodes) {
+            spare_nodes_[num_spare_nodes_++] = p;
+        } else {
+            data_allocator::deallocate(p, buffer_size());
+        }
+    }
+
+    void release_spare_nodes()
+    {
+        for (; num_spare_nodes_ != 0; --num_spare_nodes_) {
+            data_allocator::deallocate(spare_nodes_[num_spare_nodes_ - 1], buffer_size());
+        }
+    }
 
-    void deallocate_node(pointer p) { data_allocator::deallocate(p, buffer_size()); }
+    // Free the buffer of an empty deque (clear() keeps one), the spare buffers and the map
+    void destroy_map_and_nodes()
+    {
+        for (map_pointer node = begin_.node; node <= end_.node; ++node) {
+            data_allocator::deallocate(*node, buffer_size());
+        }
+        release_spare_nodes();
+        map_allocator::deallocate(map_, map_size_);
+        map_ = 0;
+        map_size_ = 0;
+    }
 
     size_type initial_map_size() { return 8; }
 
@@ -427,6 +799,9 @@ protected:
     iterator end_;        // last node of map
     map_pointer map_;     // map is a contiguous space, each element is a pointer to a buffer zone
     size_type map_size_;  // number of pointers map can hold
+    // emptied buffers kept for reuse, at least one slot so the array is never zero-sized
+    pointer spare_nodes_[max_spare_nodes != 0 ? max_spare_nodes : 1];
+    size_type num_spare_nodes_;  // number of buffers in spare_nodes_
 };
 
 }  // namespace mini::ctnr
@@ -0,0 +1,306 @@
+#ifndef MINI_CONTAINER_EYTZINGER_ARRAY_H
+#define MINI_CONTAINER_EYTZINGER_ARRAY_H
+
+#include "mini_stl/functional/mini_functional_relational.h"
+#include "mini_stl/iterator/mini_iterator_base.h"
+#include "mini_stl/memory/mini_memory.h"
+
+#include <cstdint>
+#include <utility>
+
+namespace mini::ctnr {
+
+/**
+ * @brief Immutable sorted set of values stored in Eytzinger (BFS) order: the children of the
+ *        node at index k are at 2k and 2k + 1, the root is at index 1.
+ *
+ * @attention A search walks down the implicit tree with k = 2k + (node < key), without a
+ *            branch. The first levels share a few cache lines that stay hot, and since the
+ *            descendants of a node four levels down (for 4-byte values) are contiguous, they
+ *            are prefetched one cache line per iteration, well before they are needed.
+ * @attention The storage is cache line aligned with the default allocator, index 0 is unused
+ *            so that every group of sibling descendants starts on a cache line boundary.
+ * @attention Iterators visit the values in BFS order, not in sorted order. Use the batch
+ *            lookups to search many keys at once: their cache misses overlap.
+ * @tparam T value type
+ * @tparam Compare strict weak ordering the values are sorted by
+ * @tparam Allocator 1st level allocator or sub-allocator
+ */
+template<typename T, typename Compare = func::less<T>,
+    typename Allocator = mem::cache_aligned_alloc>
+class eytzinger_array {
+public:  // public typedefs
+    typedef T value_type;
+    typedef const value_type& reference;
+    typedef const value_type& const_reference;
+    typedef const value_type* pointer;
+    typedef const value_type* const_pointer;
+    typedef const value_type* iterator;
+    typedef const value_type* const_iterator;
+    typedef size_t size_type;
+    typedef ptrdiff_t difference_type;
+    typedef Compare value_compare;
+
+protected:  // internal typedefs
+    typedef eytzinger_array<T, Compare, Allocator> self;
+    typedef mem::simple_alloc<value_type, Allocator> data_allocator;
+
+    // searches advanced in lockstep by the batch lookups
+    static constexpr size_type batch_size = 16;
+
+    // Index distance to the first descendant of a node one cache line of values further down
+    static constexpr size_type prefetch_stride =
+        sizeof(T) < mem::cache_line_size ? mem::cache_line_size / sizeof(T) : 1;
+
+public:
+    explicit eytzinger_array(const Compare& comp = Compare())
+        : data_(0)
+        , size_(0)
+        , comp_(comp)
+    {}
+
+    /**
+     * @brief Lay out the values of [first, last), sorted by 'comp', in BFS order.
+     */
+    template<typename ForwardIterator>
+    eytzinger_array(ForwardIterator first, ForwardIterator last, const Compare& comp = Compare())
+        : data_(0)
+        , size_(0)
+        , comp_(comp)
+    {
+        const size_type n = size_type(iter::distance(first, last));
+        if (n == 0) {
+            return;
+        }
+        data_ = data_allocator::allocate(n + 1);
+        size_ = n;
+        // an in-order traversal of the implicit tree meets the nodes in sorted order
+        size_type count = 0;
+        try {
+            for (size_type k = first_in_order(); k != 0; k = next_in_order(k), ++first) {
+                mem::construct(data_ + k, *first);
+                ++count;
+            }
+        } catch (...) {
+            size_type k = first_in_order();
+            for (; count != 0; --count, k = next_in_order(k)) {
+                mem::destroy(data_ + k);
+            }
+            data_allocator::deallocate(data_, n + 1);
+            throw;
+        }
+    }
+
+    eytzinger_array(const self& other)
+        : data_(0)
+        , size_(0)
+        , comp_(other.comp_)
+    {
+        if (other.size_ != 0) {
+            data_ = data_allocator::allocate(other.size_ + 1);
+            try {
+                mem::uninitialized_copy(other.begin(), other.end(), data_ + 1);
+            } catch (...) {
+                data_allocator::deallocate(data_, other.size_ + 1);
+                throw;
+            }
+            size_ = other.size_;
+        }
+    }
+
+    eytzinger_array(self&& other) noexcept
+        : eytzinger_array(other.comp_)
+    {
+        swap(other);
+    }
+
+    self& operator=(self other)
+    {
+        swap(other);
+        return *this;
+    }
+
+    ~eytzinger_array()
+    {
+        if (data_) {
+            mem::destroy(data_ + 1, data_ + size_ + 1);
+            data_allocator::deallocate(data_, size_ + 1);
+        }
+    }
+
+public:
+    // Iterators, in BFS order
+
+    const_iterator begin() const { return data_ ? data_ + 1 : data_; }
+
+    const_iterator end() const { return data_ ? data_ + size_ + 1 : data_; }
+
+    // Capacity
+
+    size_type size() const { return size_; }
+
+    bool empty() const { return size_ == 0; }
+
+    value_compare value_comp() const { return comp_; }
+
+    // Lookup
+
+    /**
+     * @brief The smallest value not less than 'key', or end()
+     */
+    const_iterator lower_bound(const value_type& key) const { return bound<false>(key); }
+
+    /**
+     * @brief The smallest value greater than 'key', or end()
+     */
+    const_iterator upper_bound(const value_type& key) const { return bound<true>(key); }
+
+    /**
+     * @brief A value equal to 'key', or end()
+     */
+    const_iterator find(const value_type& key) const
+    {
+        const_iterator it = lower_bound(key);
+        return it != end() && !comp_(key, *it) ? it : end();
+    }
+
+    bool contains(const value_type& key) const { return find(key) != end(); }
+
+    /**
+     * @brief Write lower_bound(key) to 'result' for every key of [first, last), in order.
+     *
+     * @attention Searches 16 keys in lockstep, one tree level at a time: the loads of the
+     *            different searches are independent, so their cache misses overlap instead of
+     *            being paid one after the other.
+     * @return Output iterator past the last result
+     */
+    template<typename ForwardIterator, typename OutputIterator>
+    OutputIterator batch_lower_bound(
+        ForwardIterator first, ForwardIterator last, OutputIterator result) const
+    {
+        return batch_bound<false>(first, last, result);
+    }
+
+    /**
+     * @brief Write upper_bound(key) to 'result' for every key of [first, last), in order.
+     */
+    template<typename ForwardIterator, typename OutputIterator>
+    OutputIterator batch_upper_bound(
+        ForwardIterator first, ForwardIterator last, OutputIterator result) const
+    {
+        return batch_bound<true>(first, last, result);
+    }
+
+    void swap(self& other) noexcept
+    {
+        std::swap(data_, other.data_);
+        std::swap(size_, other.size_);
+        std::swap(comp_, other.comp_);
+    }
+
+protected:  // internal methods
+    // Leftmost node: the smallest value
+    size_type first_in_order() const
+    {
+        size_type k = 1;
+        while (2 * k <= size_) {
+            k *= 2;
+        }
+        return k;
+    }
+
+    // Node of the next value in sorted order, 0 after the largest one
+    size_type next_in_order(size_type k) const
+    {
+        if (2 * k + 1 <= size_) {
+            // leftmost node of the right subtree
+            k = 2 * k + 1;
+            while (2 * k <= size_) {
+                k *= 2;
+            }
+            return k;
+        }
+        // up past the right children, then once more past the left one
+        return k >> __builtin_ffsll((long long)~k);
+    }
+
+    // Whether a search for 'key' goes right at 'node'
+    template<bool Upper, typename Key>
+    bool goes_right(const value_type& node, const Key& key) const
+    {
+        return Upper ? !comp_(key, node) : comp_(node, key);
+    }
+
+    void prefetch(size_type k) const
+    {
+        // may be past the storage: never dereferenced, so compute it as an integer
+        __builtin_prefetch(
+            reinterpret_cast<const void*>(uintptr_t(data_) + k * prefetch_stride * sizeof(T)));
+    }
+
+    // Position of the value reached by a descent that ended at index 'k'
+    const_iterator position(size_type k) const
+    {
+        // the turns of the descent are the bits of k: drop the right turns taken after the
+        // last left one, then the left turn itself, to get back to the node it turned at
+        k >>= __builtin_ffsll((long long)~k);
+        return k == 0 ? end() : data_ + k;
+    }
+
+    template<bool Upper>
+    const_iterator bound(const value_type& key) const
+    {
+        size_type k = 1;
+        while (k <= size_) {
+            prefetch(k);
+            k = 2 * k + goes_right<Upper>(data_[k], key);
+        }
+        return position(k);
+    }
+
+    template<bool Upper, typename ForwardIterator, typename OutputIterator>
+    OutputIterator batch_bound(
+        ForwardIterator first, ForwardIterator last, OutputIterator result) const
+    {
+        // every descent crosses the 'full_levels' complete levels, then maybe one more node
+        size_type full_levels = 0;
+        while ((size_type(2) << full_levels) - 1 <= size_) {
+            ++full_levels;
+        }
+        ForwardIterator keys[batch_size];
+        size_type nodes[batch_size];
+        while (first != last) {
+            size_type count = 0;
+            for (; count < batch_size && first != last; ++count, ++first) {
+                keys[count] = first;
+                nodes[count] = 1;
+            }
+            for (size_type level = 0; level < full_levels; ++level) {
+                for (size_type i = 0; i < count; ++i) {
+                    const size_type k = nodes[i];
+                    nodes[i] = 2 * k + goes_right<Upper>(data_[k], *keys[i]);
+                    // the node of the next level, needed after the other searches moved on
+                    __builtin_prefetch(data_ + (nodes[i] <= size_ ? nodes[i] : 0));
+                }
+            }
+            for (size_type i = 0; i < count; ++i) {
+                size_type k = nodes[i];
+                if (k <= size_) {
+                    k = 2 * k + goes_right<Upper>(data_[k], *keys[i]);
+                }
+                *result = position(k);
+                ++result;
+            }
+        }
+        return result;
+    }
+
+protected:
+    T* data_;         // storage of size_ + 1 slots, values at indices [1, size_], 0 if empty
+    size_type size_;  // number of values
+    Compare comp_;    // order of the values
+};
+
+}  // namespace mini::ctnr
+
+#endif
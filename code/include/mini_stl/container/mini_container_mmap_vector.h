@@ -0,0 +1,381 @@
+#ifndef MINI_CONTAINER_MMAP_VECTOR_H
+#define MINI_CONTAINER_MMAP_VECTOR_H
+
+#include "mini_stl/base/mini_base_macro.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstddef>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+
+namespace mini::ctnr {
+
+/**
+ * @brief A vector whose storage is a shared memory mapping of a file.
+ *
+ * @attention Only trivially copyable types are supported: elements are the raw bytes of the file.
+ * @attention While the container is open the file length equals capacity() * sizeof(T); the file
+ *            is truncated back to size() * sizeof(T) on close(), so the file always holds exactly
+ *            the elements of the container once closed.
+ * @attention Opening read-only maps the file with PROT_READ: no parsing and no copy, pages are
+ *            loaded on demand and shared with every other process mapping the same file.
+ * @attention Growth extends the file with ftruncate() and the mapping with mremap() (Linux), or
+ *            by remapping on other POSIX systems. Pointers and iterators are invalidated by growth.
+ * @attention Changes reach the file when the kernel writes back dirty pages; call flush() to
+ *            force them out (msync).
+ * @tparam T value type
+ */
+template<typename T>
+class mmap_vector {
+    static_assert(std::is_trivially_copyable<T>::value,
+        "mmap_vector requires a trivially copyable value type");
+
+    MINI_DISALLOW_COPY_AND_ASSIGN(mmap_vector);
+
+public:
+    typedef T value_type;
+    typedef value_type* pointer;
+    typedef value_type* iterator;
+    typedef const value_type* const_iterator;
+    typedef value_type& reference;
+    typedef const value_type& const_reference;
+    typedef size_t size_type;
+    typedef ptrdiff_t difference_type;
+
+    enum class open_mode {
+        read_only,   // map an existing file, no modification allowed
+        read_write,  // map an existing file
+        create,      // create the file if missing, truncate it to zero elements
+    };
+
+public:
+    mmap_vector()
+        : fd_(-1)
+        , read_only_(false)
+        , begin_(0)
+        , size_(0)
+        , capacity_(0)
+    {}
+
+    explicit mmap_vector(const char* path, open_mode mode = open_mode::read_write)
+        : mmap_vector()
+    {
+        open(path, mode);
+    }
+
+    mmap_vector(mmap_vector&& other) noexcept
+        : mmap_vector()
+    {
+        swap(other);
+    }
+
+    mmap_vector& operator=(mmap_vector&& other) noexcept
+    {
+        if (this != &other) {
+            close_noexcept();
+            swap(other);
+        }
+        return *this;
+    }
+
+    ~mmap_vector() { close_noexcept(); }
+
+public:
+    // File management
+
+    void open(const char* path, open_mode mode = open_mode::read_write)
+    {
+        close();
+
+        int flags = O_RDWR;
+        if (mode == open_mode::read_only) {
+            flags = O_RDONLY;
+        } else if (mode == open_mode::create) {
+            flags = O_RDWR | O_CREAT | O_TRUNC;
+        }
+        int fd = ::open(path, flags, 0644);
+        if (fd < 0) {
+            throw_system_error("open() failed");
+        }
+
+        struct stat st;
+        if (::fstat(fd, &st) != 0) {
+            int err = errno;
+            ::close(fd);
+            errno = err;
+            throw_system_error("fstat() failed");
+        }
+        if (size_type(st.st_size) % sizeof(T) != 0) {
+            ::close(fd);
+            throw std::runtime_error(
+                "mini::ctnr::mmap_vector: file size is not a multiple of sizeof(T)");
+        }
+
+        fd_ = fd;
+        read_only_ = (mode == open_mode::read_only);
+        size_ = size_type(st.st_size) / sizeof(T);
+        capacity_ = size_;
+        if (capacity_ != 0) {
+            try {
+                begin_ = map(capacity_);
+            } catch (...) {
+                ::close(fd_);
+                fd_ = -1;
+                size_ = capacity_ = 0;
+                throw;
+            }
+        }
+    }
+
+    /**
+     * @brief Flush, unmap and close the file. The file is trimmed to size() elements.
+     *
+     * @attention The container is closed even when unmapping or trimming fails: the first error
+     *            is reported once the descriptor is released.
+     */
+    void close()
+    {
+        if (!is_open()) {
+            return;
+        }
+        const char* failed = 0;
+        int error = 0;
+        if (begin_ && ::munmap(begin_, capacity_ * sizeof(T)) != 0) {
+            failed = "munmap() failed";
+            error = errno;
+        }
+        begin_ = 0;
+        if (!read_only_ && capacity_ != size_ && ::ftruncate(fd_, size_ * sizeof(T)) != 0
+            && !failed) {
+            failed = "ftruncate() failed";
+            error = errno;
+        }
+        ::close(fd_);
+        fd_ = -1;
+        size_ = capacity_ = 0;
+        if (failed) {
+            throw_system_error(failed, error);
+        }
+    }
+
+    /**
+     * @brief Write dirty pages of the mapping back to the file.
+     *
+     * @param async Schedule the write-back (MS_ASYNC) instead of waiting for it (MS_SYNC)
+     */
+    void flush(bool async = false)
+    {
+        if (!begin_ || read_only_) {
+            return;
+        }
+        if (::msync(begin_, capacity_ * sizeof(T), async ? MS_ASYNC : MS_SYNC) != 0) {
+            throw_system_error("msync() failed");
+        }
+    }
+
+    bool is_open() const { return fd_ >= 0; }
+
+    bool read_only() const { return read_only_; }
+
+public:
+    // Element access
+
+    reference operator[](size_type n) { return *(begin() + n); }
+
+    const_reference operator[](size_type n) const { return *(begin() + n); }
+
+    reference at(size_type n)
+    {
+        if (n >= size()) {
+            throw std::out_of_range("mini::ctnr::mmap_vector: out_of_range failure: n >= size()");
+        }
+        return *(begin() + n);
+    }
+
+    reference front() { return *begin(); }
+
+    reference back() { return *(end() - 1); }
+
+    pointer data() { return begin_; }
+
+    const value_type* data() const { return begin_; }
+
+    // Iterators
+
+    iterator begin() { return begin_; }
+
+    const_iterator begin() const { return begin_; }
+
+    iterator end() { return begin_ + size_; }
+
+    const_iterator end() const { return begin_ + size_; }
+
+    // Capacity
+
+    size_type size() const { return size_; }
+
+    size_type capacity() const { return capacity_; }
+
+    bool empty() const { return size_ == 0; }
+
+    void reserve(size_type new_cap)
+    {
+        if (new_cap <= capacity_) {
+            return;
+        }
+        check_writable();
+        remap(new_cap);
+    }
+
+    // Modifiers
+
+    void clear()
+    {
+        check_writable();
+        size_ = 0;
+    }
+
+    void push_back(const_reference value)
+    {
+        check_writable();
+        if (size_ == capacity_) {
+            value_type copy = value;  // 'value' may live in the mapping that is about to move
+            remap(grow_capacity(size_ + 1));
+            begin_[size_++] = copy;
+        } else {
+            begin_[size_++] = value;
+        }
+    }
+
+    void pop_back()
+    {
+        check_writable();
+        --size_;
+    }
+
+    void resize(size_type new_size, const_reference value = value_type())
+    {
+        check_writable();
+        value_type copy = value;  // 'value' may live in the mapping that is about to move
+        if (new_size > capacity_) {
+            remap(grow_capacity(new_size));
+        }
+        for (; size_ < new_size; ++size_) {
+            begin_[size_] = copy;
+        }
+        size_ = new_size;
+    }
+
+    /**
+     * @brief Release the reserved but unused tail of the file.
+     */
+    void shrink_to_fit()
+    {
+        if (read_only_ || capacity_ == size_) {
+            return;
+        }
+        remap(size_);
+    }
+
+    void swap(mmap_vector& other) noexcept
+    {
+        std::swap(fd_, other.fd_);
+        std::swap(read_only_, other.read_only_);
+        std::swap(begin_, other.begin_);
+        std::swap(size_, other.size_);
+        std::swap(capacity_, other.capacity_);
+    }
+
+protected:
+    [[noreturn]] static void throw_system_error(const char* what, int error = errno)
+    {
+        throw std::system_error(
+            error, std::generic_category(), std::string("mini::ctnr::mmap_vector: ") + what);
+    }
+
+    void check_writable() const
+    {
+        if (!is_open()) {
+            throw std::logic_error("mini::ctnr::mmap_vector: no file is open");
+        }
+        if (read_only_) {
+            throw std::logic_error("mini::ctnr::mmap_vector: container is read-only");
+        }
+    }
+
+    size_type grow_capacity(size_type min_cap) const
+    {
+        // start from one page worth of elements, then double
+        const size_type page_elements = size_type(::sysconf(_SC_PAGESIZE)) / sizeof(T);
+        size_type new_cap = capacity_ != 0 ? capacity_ * 2 : (page_elements ? page_elements : 1);
+        return new_cap < min_cap ? min_cap : new_cap;
+    }
+
+    pointer map(size_type n)
+    {
+        int prot = read_only_ ? PROT_READ : (PROT_READ | PROT_WRITE);
+        void* p = ::mmap(0, n * sizeof(T), prot, MAP_SHARED, fd_, 0);
+        if (p == MAP_FAILED) {
+            throw_system_error("mmap() failed");
+        }
+        return static_cast<pointer>(p);
+    }
+
+    // Resize the file and the mapping to hold exactly 'new_cap' elements
+    void remap(size_type new_cap)
+    {
+        if (::ftruncate(fd_, new_cap * sizeof(T)) != 0) {
+            throw_system_error("ftruncate() failed");
+        }
+        if (new_cap == 0) {
+            if (begin_ && ::munmap(begin_, capacity_ * sizeof(T)) != 0) {
+                throw_system_error("munmap() failed");
+            }
+            begin_ = 0;
+        } else if (!begin_) {
+            begin_ = map(new_cap);
+        } else {
+#ifdef MREMAP_MAYMOVE
+            void* p = ::mremap(begin_, capacity_ * sizeof(T), new_cap * sizeof(T), MREMAP_MAYMOVE);
+            if (p == MAP_FAILED) {
+                throw_system_error("mremap() failed");
+            }
+            begin_ = static_cast<pointer>(p);
+#else
+            // no mremap(): the file holds the data, so a fresh mapping sees the same contents
+            pointer p = map(new_cap);
+            ::munmap(begin_, capacity_ * sizeof(T));
+            begin_ = p;
+#endif
+        }
+        capacity_ = new_cap;
+    }
+
+    void close_noexcept() noexcept
+    {
+        try {
+            close();
+        } catch (...) {
+            // destructor path: the mapping is released by the kernel at worst
+        }
+    }
+
+protected:
+    int fd_;              // file descriptor of the backing file, -1 when closed
+    bool read_only_;      // mapped with PROT_READ only
+    pointer begin_;       // start of the mapping
+    size_type size_;      // number of elements in use
+    size_type capacity_;  // number of elements the file (and the mapping) can hold
+};
+
+}  // namespace mini::ctnr
+
+#endif
@@ -0,0 +1,419 @@
+#ifndef MINI_CONTAINER_SOA_VECTOR_H
+#define MINI_CONTAINER_SOA_VECTOR_H
+
+#include "mini_stl/algorithm/mini_algorithm.h"
+#include "mini_stl/memory/mini_memory.h"
+
+#include <stdexcept>
+#include <tuple>
+#include <utility>
+
+namespace mini::ctnr {
+
+/**
+ * @brief A non-owning view over one column of a soa_vector.
+ *
+ * @attention Invalidated by any operation that reallocates the owning container.
+ * @tparam T Column element type
+ */
+template<typename T>
+struct soa_span {
+    typedef T value_type;
+    typedef T* pointer;
+    typedef T* iterator;
+    typedef T& reference;
+    typedef size_t size_type;
+
+    iterator begin() const { return first_; }
+
+    iterator end() const { return last_; }
+
+    pointer data() const { return first_; }
+
+    size_type size() const { return size_type(last_ - first_); }
+
+    bool empty() const { return first_ == last_; }
+
+    reference operator[](size_type n) const { return first_[n]; }
+
+    T* first_;
+    T* last_;
+};
+
+/**
+ * @brief Struct-of-arrays vector: each field is stored in its own contiguous column.
+ *
+ * @attention All columns share one size and one capacity, every modifier keeps them in sync.
+ * @attention Element access returns a tuple of references (a proxy), not a reference to a struct.
+ * @attention Scanning one field only touches that field's column, which keeps hot loops
+ *            from dragging unused fields through cache.
+ * @tparam Allocator 1st level allocator or sub-allocator
+ * @tparam Fields Field types, one column per field
+ */
+template<typename Allocator, typename... Fields>
+class basic_soa_vector {
+    static_assert(sizeof...(Fields) > 0, "soa_vector requires at least one field");
+
+public:
+    typedef std::tuple<Fields...> value_type;
+    typedef std::tuple<Fields&...> reference;
+    typedef std::tuple<const Fields&...> const_reference;
+    typedef size_t size_type;
+    typedef ptrdiff_t difference_type;
+
+    template<size_t I>
+    using field_type = std::tuple_element_t<I, value_type>;
+
+    typedef basic_soa_vector<Allocator, Fields...> self;
+
+protected:
+    template<size_t I>
+    using column_allocator = mem::simple_alloc<field_type<I>, Allocator>;
+
+    typedef std::index_sequence_for<Fields...> field_indices;
+
+public:
+    basic_soa_vector()
+        : columns_()
+        , size_(0)
+        , capacity_(0)
+    {}
+
+    explicit basic_soa_vector(size_type n)
+        : basic_soa_vector()
+    {
+        resize(n);
+    }
+
+    basic_soa_vector(const self& other)
+        : basic_soa_vector()
+    {
+        reallocate(other.size_, other, field_indices());
+    }
+
+    basic_soa_vector(self&& other) noexcept
+        : basic_soa_vector()
+    {
+        swap(other);
+    }
+
+    self& operator=(self other)
+    {
+        swap(other);
+        return *this;
+    }
+
+    ~basic_soa_vector() { destroy_and_deallocate(field_indices()); }
+
+public:
+    // Element access
+
+    reference operator[](size_type n) { return row(n, field_indices()); }
+
+    const_reference operator[](size_type n) const { return row(n, field_indices()); }
+
+    reference at(size_type n)
+    {
+        if (n >= size()) {
+            throw std::out_of_range("mini::ctnr::soa_vector: out_of_range failure: n >= size()");
+        }
+        return row(n, field_indices());
+    }
+
+    reference front() { return row(0, field_indices()); }
+
+    reference back() { return row(size_ - 1, field_indices()); }
+
+    // Access one field of one element without touching any other column
+    template<size_t I>
+    field_type<I>& get(size_type n)
+    {
+        return std::get<I>(columns_)[n];
+    }
+
+    template<size_t I>
+    const field_type<I>& get(size_type n) const
+    {
+        return std::get<I>(columns_)[n];
+    }
+
+    // Column access
+
+    template<size_t I>
+    field_type<I>* data()
+    {
+        return std::get<I>(columns_);
+    }
+
+    template<size_t I>
+    const field_type<I>* data() const
+    {
+        return std::get<I>(columns_);
+    }
+
+    template<size_t I>
+    soa_span<field_type<I>> column()
+    {
+        return soa_span<field_type<I>>{std::get<I>(columns_), std::get<I>(columns_) + size_};
+    }
+
+    template<size_t I>
+    soa_span<const field_type<I>> column() const
+    {
+        return soa_span<const field_type<I>>{std::get<I>(columns_), std::get<I>(columns_) + size_};
+    }
+
+    // Capacity
+
+    size_type size() const { return size_; }
+
+    size_type capacity() const { return capacity_; }
+
+    bool empty() const { return size_ == 0; }
+
+    void reserve(size_type new_cap)
+    {
+        if (new_cap <= capacity_) {
+            return;
+        }
+        reallocate(new_cap, *this, field_indices());
+    }
+
+    // Modifiers
+
+    /**
+     * @brief Append one element, constructing each field in its own column.
+     *
+     * @attention The number of arguments must equal the number of fields, the i-th argument
+     *            is forwarded to the constructor of the i-th field.
+     */
+    template<typename... Args>
+    void emplace_back(Args&&... args)
+    {
+        static_assert(sizeof...(Args) == sizeof...(Fields), "one argument per field is required");
+        if (size_ == capacity_) {
+            // construct into the new storage before the old one is released,
+            // arguments may refer to elements of this container
+            grow_and_emplace_back(field_indices(), std::forward<Args>(args)...);
+        } else {
+            construct_row(columns_, size_, field_indices(), std::forward<Args>(args)...);
+        }
+        ++size_;
+    }
+
+    void push_back(const Fields&... values) { emplace_back(values...); }
+
+    void push_back(Fields&&... values) { emplace_back(std::move(values)...); }
+
+    void push_back(const value_type& value)
+    {
+        std::apply([this](const Fields&... values) { emplace_back(values...); }, value);
+    }
+
+    void pop_back()
+    {
+        --size_;
+        destroy_range(size_, size_ + 1, field_indices());
+    }
+
+    /**
+     * @brief Erase the element at index 'pos' from every column.
+     *
+     * @return size_type Index of the element following the erased one
+     */
+    size_type erase(size_type pos) { return erase(pos, pos + 1); }
+
+    /**
+     * @brief Erase the elements within index range [first, last) from every column.
+     *
+     * @return size_type Index of the element following the erased range
+     */
+    size_type erase(size_type first, size_type last)
+    {
+        if (first == last) {
+            return first;
+        }
+        shift_down(first, last, field_indices());
+        destroy_range(size_ - (last - first), size_, field_indices());
+        size_ -= last - first;
+        return first;
+    }
+
+    void clear()
+    {
+        destroy_range(0, size_, field_indices());
+        size_ = 0;
+    }
+
+    void resize(size_type new_size)
+    {
+        if (new_size < size_) {
+            erase(new_size, size_);
+            return;
+        }
+        reserve(new_size);
+        fill_range(size_, new_size, field_indices());
+        size_ = new_size;
+    }
+
+    void swap(self& other) noexcept
+    {
+        std::swap(columns_, other.columns_);
+        std::swap(size_, other.size_);
+        std::swap(capacity_, other.capacity_);
+    }
+
+protected:
+    typedef std::tuple<Fields*...> columns_type;
+
+    size_type grow_capacity() const { return capacity_ != 0 ? capacity_ * 2 : 1; }
+
+    template<size_t... I>
+    reference row(size_type n, std::index_sequence<I...>)
+    {
+        return reference(std::get<I>(columns_)[n]...);
+    }
+
+    template<size_t... I>
+    const_reference row(size_type n, std::index_sequence<I...>) const
+    {
+        return const_reference(std::get<I>(columns_)[n]...);
+    }
+
+    // Construct element 'n' in every column of 'columns'. If a field's constructor throws,
+    // fields already constructed for this element are destroyed before rethrowing.
+    template<size_t... I, typename... Args>
+    static void construct_row(
+        columns_type& columns, size_type n, std::index_sequence<I...>, Args&&... args)
+    {
+        size_t constructed = 0;
+        try {
+            ((mem::construct(std::get<I>(columns) + n, std::forward<Args>(args)), ++constructed),
+                ...);
+        } catch (...) {
+            ((I < constructed ? mem::destroy(std::get<I>(columns) + n) : void()), ...);
+            throw;
+        }
+    }
+
+    template<size_t... I>
+    static columns_type allocate_columns(size_type n, std::index_sequence<I...>)
+    {
+        return columns_type(column_allocator<I>::allocate(n)...);
+    }
+
+    template<size_t... I>
+    static void deallocate_columns(columns_type& columns, size_type n, std::index_sequence<I...>)
+    {
+        (column_allocator<I>::deallocate(std::get<I>(columns), n), ...);
+    }
+
+    // Copy the first 'source.size_' elements of 'source' into 'columns', column by column.
+    // On failure, columns that were fully copied are destroyed before rethrowing.
+    template<size_t... I>
+    static void copy_columns(columns_type& columns, const self& source, std::index_sequence<I...>)
+    {
+        size_t copied = 0;
+        try {
+            ((mem::uninitialized_copy(std::get<I>(source.columns_),
+                  std::get<I>(source.columns_) + source.size_, std::get<I>(columns)),
+                 ++copied),
+                ...);
+        } catch (...) {
+            ((I < copied
+                     ? mem::destroy(std::get<I>(columns), std::get<I>(columns) + source.size_)
+                     : void()),
+                ...);
+            throw;
+        }
+    }
+
+    // Replace current storage with 'new_cap' slots holding a copy of 'source' elements
+    template<size_t... I>
+    void reallocate(size_type new_cap, const self& source, std::index_sequence<I...> indices)
+    {
+        const size_type new_size = source.size_;  // 'source' may be *this
+        columns_type new_columns = allocate_columns(new_cap, indices);
+        try {
+            copy_columns(new_columns, source, indices);
+        } catch (...) {
+            deallocate_columns(new_columns, new_cap, indices);
+            throw;
+        }
+        destroy_and_deallocate(indices);
+        columns_ = new_columns;
+        size_ = new_size;
+        capacity_ = new_cap;
+    }
+
+    template<size_t... I, typename... Args>
+    void grow_and_emplace_back(std::index_sequence<I...> indices, Args&&... args)
+    {
+        const size_type new_cap = grow_capacity();
+        columns_type new_columns = allocate_columns(new_cap, indices);
+        try {
+            copy_columns(new_columns, *this, indices);
+            try {
+                construct_row(new_columns, size_, indices, std::forward<Args>(args)...);
+            } catch (...) {
+                (mem::destroy(std::get<I>(new_columns), std::get<I>(new_columns) + size_), ...);
+                throw;
+            }
+        } catch (...) {
+            deallocate_columns(new_columns, new_cap, indices);
+            throw;
+        }
+        const size_type old_size = size_;
+        destroy_and_deallocate(indices);
+        columns_ = new_columns;
+        size_ = old_size;
+        capacity_ = new_cap;
+    }
+
+    // Move elements in [last, size_) of every column down to 'first'
+    template<size_t... I>
+    void shift_down(size_type first, size_type last, std::index_sequence<I...>)
+    {
+        (algo::copy(std::get<I>(columns_) + last, std::get<I>(columns_) + size_,
+             std::get<I>(columns_) + first),
+            ...);
+    }
+
+    template<size_t... I>
+    void fill_range(size_type first, size_type last, std::index_sequence<I...>)
+    {
+        (mem::uninitialized_fill_n(std::get<I>(columns_) + first, last - first, field_type<I>()),
+            ...);
+    }
+
+    template<size_t... I>
+    void destroy_range(size_type first, size_type last, std::index_sequence<I...>)
+    {
+        (mem::destroy(std::get<I>(columns_) + first, std::get<I>(columns_) + last), ...);
+    }
+
+    template<size_t... I>
+    void destroy_and_deallocate(std::index_sequence<I...> indices)
+    {
+        if (capacity_ == 0) {
+            return;
+        }
+        destroy_range(0, size_, indices);
+        deallocate_columns(columns_, capacity_, indices);
+        columns_ = columns_type();
+        size_ = 0;
+        capacity_ = 0;
+    }
+
+protected:
+    columns_type columns_;  // one contiguous array per field
+    size_type size_;        // number of elements, shared by all columns
+    size_type capacity_;    // number of slots allocated in each column
+};
+
+template<typename... Fields>
+using soa_vector = basic_soa_vector<mem::alloc, Fields...>;
+
+}  // namespace mini::ctnr
+
+#endif
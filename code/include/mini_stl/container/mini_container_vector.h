@@ -4,6 +4,9 @@
 #include "mini_stl/algorithm/mini_algorithm.h"
 #include "mini_stl/memory/mini_memory.h"
 
+#include <limits>
+#include <utility>
+
 namespace mini::ctnr {
 
 template<typename T, typename Allocator = mini::mem::alloc>
@@ -130,6 +133,16 @@ public:
         }
     }
 
+    void push_back(value_type&& value)
+    {
+        if (end_ != end_of_storage_) {
+            mem::construct(end_, std::move(value));
+            ++end_;
+        } else {
+            insert_aux(end(), std::move(value));
+        }
+    }
+
     void pop_back()
     {
         --end_;
@@ -201,7 +214,7 @@ public:
                 mem::uninitialized_copy(end_ - n, end_, end_);
                 end_ += n;
                 algo::copy_backward(pos, old_finish - n, old_finish);
-                std::fill(pos, pos + n, value);
+                algo::fill(pos, pos + n, value);
             } else {  // number of existing elements after insert pos <= n
                 // |---       n         ---|
                 // |-- elements after--|--------> unintialized
@@ -211,7 +224,7 @@ public:
                 end_ += (n - num_elements_after);
                 mem::uninitialized_copy(pos, old_finish, end_);
                 end_ += num_elements_after;
-                std::fill(pos, old_finish, value);
+                algo::fill(pos, old_finish, value);
             }
         } else {  // reserved space less than number of new elements going to insert
             const size_type old_size = size();
@@ -268,9 +281,10 @@ protected:
      * @brief Insert a value at a position
      *
      * @param pos position to insert
-     * @param value element to insert
+     * @param value element to insert, moved from if an rvalue
      */
-    void insert_aux(iterator pos, const_reference value)
+    template<typename U>
+    void insert_aux(iterator pos, U&& value)
     {
         // Have reserved space: not yet reached capacity
         if (end_ != end_of_storage_) {
@@ -279,7 +293,7 @@ protected:
             ++end_;
             // shift backward all elements starting from insert position
             algo::copy_backward(pos, end_ - 2, end_ - 1);
-            *pos = value;
+            *pos = std::forward<U>(value);
         } else {
             // No reserved space available
 
@@ -292,7 +306,7 @@ protected:
 
             try {  // copy data from original memory space to new memory space
                 new_finish = mem::uninitialized_copy(begin_, pos, new_start);
-                mem::construct(new_finish, value);
+                mem::construct(new_finish, std::forward<U>(value));
                 ++new_finish;
                 new_finish = mem::uninitialized_copy(pos, end_, new_finish);
             } catch (...) {
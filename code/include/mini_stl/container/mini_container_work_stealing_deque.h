@@ -0,0 +1,218 @@
+#ifndef MINI_CONTAINER_WORK_STEALING_DEQUE_H
+#define MINI_CONTAINER_WORK_STEALING_DEQUE_H
+
+#include "mini_stl/base/mini_base_macro.h"
+#include "mini_stl/memory/mini_memory.h"
+
+#include <atomic>
+#include <cstdint>
+#include <type_traits>
+
+namespace mini::ctnr {
+
+/**
+ * @brief Chase-Lev work-stealing deque.
+ *
+ * One owner thread pushes and pops at the bottom (LIFO, cache-warm tasks first), any number of
+ * thief threads steal from the top (FIFO, oldest and usually largest tasks first). The owner
+ * only synchronizes with thieves when one element is left; thieves race with one CAS on top.
+ * Memory orderings follow Le, Pop, Cohen and Zappa Nardelli, "Correct and Efficient
+ * Work-Stealing for Weak Memory Models" (PPoPP 2013).
+ *
+ * @attention push() and pop() may only be called by the owner thread, steal() by any thread.
+ * @attention T must be trivially copyable (typically a pointer to a task): a thief may read a
+ *            slot that the owner is overwriting, and discards the value if its CAS fails.
+ * @attention The circular array grows by doubling when full. A thief may still be reading the
+ *            old array, so retired arrays are kept until the deque is destroyed (their total
+ *            size is below the size of the live array).
+ * @tparam T value type
+ * @tparam Allocator 1st level allocator or sub-allocator, cache-line aligned by default
+ */
+template<typename T, typename Allocator = mem::cache_aligned_alloc>
+class work_stealing_deque {
+    static_assert(std::is_trivially_copyable<T>::value,
+        "work_stealing_deque requires a trivially copyable value type");
+
+    MINI_DISALLOW_COPY_AND_MOVE(work_stealing_deque);
+
+public:
+    typedef T value_type;
+    typedef size_t size_type;
+
+protected:
+    // Power-of-two circular array indexed by the unbounded top/bottom counters
+    struct ring {
+        int64_t capacity;
+        int64_t mask;
+        std::atomic<T>* slots;
+        ring* retired_next;  // next older retired array
+
+        T get(int64_t i) const { return slots[i & mask].load(std::memory_order_relaxed); }
+
+        void put(int64_t i, T value) { slots[i & mask].store(value, std::memory_order_relaxed); }
+    };
+
+    typedef mem::simple_alloc<ring, Allocator> ring_allocator;
+    typedef mem::simple_alloc<std::atomic<T>, Allocator> slot_allocator;
+
+public:
+    /**
+     * @param capacity Initial capacity, rounded up to a power of two
+     */
+    explicit work_stealing_deque(size_type capacity = 64)
+        : top_(0)
+        , bottom_(0)
+        , array_(0)
+        , retired_(0)
+    {
+        int64_t cap = 1;
+        while (cap < int64_t(capacity)) {
+            cap <<= 1;
+        }
+        array_.store(new_ring(cap), std::memory_order_relaxed);
+    }
+
+    ~work_stealing_deque()
+    {
+        delete_ring(array_.load(std::memory_order_relaxed));
+        while (retired_) {
+            ring* next = retired_->retired_next;
+            delete_ring(retired_);
+            retired_ = next;
+        }
+    }
+
+public:
+    // Owner operations
+
+    void push(const value_type& value)
+    {
+        const int64_t b = bottom_.load(std::memory_order_relaxed);
+        const int64_t t = top_.load(std::memory_order_acquire);
+        ring* a = array_.load(std::memory_order_relaxed);
+        if (b - t > a->capacity - 1) {
+            a = grow(a, t, b);
+        }
+        a->put(b, value);
+        // a release store rather than a fence: publishes the slot (and whatever the element
+        // points to) to thieves, in a form race detectors understand
+        bottom_.store(b + 1, std::memory_order_release);
+    }
+
+    /**
+     * @brief Take the most recently pushed element.
+     *
+     * @return bool false if the deque is empty (or the last element was stolen meanwhile)
+     */
+    bool pop(value_type& value)
+    {
+        const int64_t b = bottom_.load(std::memory_order_relaxed) - 1;
+        ring* a = array_.load(std::memory_order_relaxed);
+        bottom_.store(b, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        int64_t t = top_.load(std::memory_order_relaxed);
+
+        if (t > b) {
+            // empty
+            bottom_.store(b + 1, std::memory_order_relaxed);
+            return false;
+        }
+        value_type x = a->get(b);
+        if (t == b) {
+            // last element: race against thieves for it, 'value' is left alone when they win
+            const bool won = top_.compare_exchange_strong(
+                t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+            bottom_.store(b + 1, std::memory_order_relaxed);
+            if (!won) {
+                return false;
+            }
+        }
+        value = x;
+        return true;
+    }
+
+    // Thief operation
+
+    /**
+     * @brief Take the oldest element. May be called from any thread.
+     *
+     * @return bool false if the deque is empty or another thread took the element first
+     */
+    bool steal(value_type& value)
+    {
+        int64_t t = top_.load(std::memory_order_acquire);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        const int64_t b = bottom_.load(std::memory_order_acquire);
+        if (t >= b) {
+            return false;
+        }
+        // acquire (instead of consume) pairs with the release store in grow()
+        ring* a = array_.load(std::memory_order_acquire);
+        value_type x = a->get(t);
+        if (!top_.compare_exchange_strong(
+                t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+            return false;
+        }
+        value = x;
+        return true;
+    }
+
+    // Observers, snapshots only when other threads are active
+
+    size_type size() const
+    {
+        const int64_t b = bottom_.load(std::memory_order_relaxed);
+        const int64_t t = top_.load(std::memory_order_relaxed);
+        return b > t ? size_type(b - t) : 0;
+    }
+
+    bool empty() const { return size() == 0; }
+
+    size_type capacity() const
+    {
+        return size_type(array_.load(std::memory_order_relaxed)->capacity);
+    }
+
+protected:
+    static ring* new_ring(int64_t capacity)
+    {
+        ring* r = ring_allocator::allocate();
+        r->capacity = capacity;
+        r->mask = capacity - 1;
+        r->slots = slot_allocator::allocate(size_type(capacity));
+        for (int64_t i = 0; i < capacity; ++i) {
+            mem::construct(r->slots + i);
+        }
+        r->retired_next = 0;
+        return r;
+    }
+
+    static void delete_ring(ring* r)
+    {
+        slot_allocator::deallocate(r->slots, size_type(r->capacity));
+        ring_allocator::deallocate(r);
+    }
+
+    // Owner only: copy live elements [t, b) into an array twice as large and publish it
+    ring* grow(ring* a, int64_t t, int64_t b)
+    {
+        ring* bigger = new_ring(a->capacity * 2);
+        for (int64_t i = t; i < b; ++i) {
+            bigger->put(i, a->get(i));
+        }
+        array_.store(bigger, std::memory_order_release);
+        a->retired_next = retired_;
+        retired_ = a;
+        return bigger;
+    }
+
+protected:
+    alignas(mem::cache_line_size) std::atomic<int64_t> top_;  // next element to steal
+    alignas(mem::cache_line_size) std::atomic<int64_t> bottom_;  // next slot to push
+    std::atomic<ring*> array_;  // live circular array
+    ring* retired_;             // arrays replaced by grow(), owner only
+};
+
+}  // namespace mini::ctnr
+
+#endif
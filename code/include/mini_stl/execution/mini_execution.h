@@ -0,0 +1,8 @@
+#ifndef MINI_EXECUTION_H
+#define MINI_EXECUTION_H
+
+#include "mini_stl/execution/mini_execution_parallel.h"
+#include "mini_stl/execution/mini_execution_policy.h"
+#include "mini_stl/execution/mini_execution_thread_pool.h"
+
+#endif
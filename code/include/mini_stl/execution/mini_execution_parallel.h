@@ -0,0 +1,83 @@
+#ifndef MINI_EXECUTION_PARALLEL_H
+#define MINI_EXECUTION_PARALLEL_H
+
+#include "mini_stl/execution/mini_execution_thread_pool.h"
+
+#include <functional>
+#include <utility>
+
+namespace mini::exec {
+
+// Split [first, last) in halves until a piece holds at most 'grain' elements. The upper half is
+// handed to the group (and can be stolen by an idle worker), the lower half is split further by
+// the calling thread, which finally runs 'func' on the leftmost piece itself.
+template<typename Index, typename Function>
+void __parallel_for_split(task_group& group, Index first, Index last, size_t grain, Function& func)
+{
+    while (size_t(last - first) > grain) {
+        Index mid = first + (last - first) / 2;
+        group.run([&group, mid, last, grain, &func] {
+            __parallel_for_split(group, mid, last, grain, func);
+        });
+        last = mid;
+    }
+    func(first, last);
+}
+
+/**
+ * @brief Call func(sub_first, sub_last) on disjoint pieces of [first, last) in parallel.
+ *
+ * @attention Index is an integral type or a random access iterator.
+ * @attention Pieces hold at most 'grain' elements (at least 1), and more than grain / 2 unless
+ *            the whole range is smaller. Choose a grain large enough to amortize scheduling.
+ * @attention Returns once every piece is done. The first exception thrown by 'func' is
+ *            rethrown.
+ * @param pool Pool running the pieces
+ * @param first Start of the range
+ * @param last End of the range
+ * @param grain Maximum number of elements per piece
+ * @param func Callable taking (Index sub_first, Index sub_last)
+ */
+template<typename Index, typename Function>
+void parallel_for(thread_pool& pool, Index first, Index last, size_t grain, Function&& func)
+{
+    if (!(first < last)) {
+        return;
+    }
+    if (grain == 0) {
+        grain = 1;
+    }
+    if (size_t(last - first) <= grain) {
+        func(first, last);  // not worth a task
+        return;
+    }
+    // if the calling thread's piece throws, ~task_group() still waits for the other pieces
+    task_group group(pool);
+    __parallel_for_split(group, first, last, grain, func);
+    group.wait();
+}
+
+template<typename Index, typename Function>
+void parallel_for(Index first, Index last, size_t grain, Function&& func)
+{
+    parallel_for(default_thread_pool(), first, last, grain, std::forward<Function>(func));
+}
+
+/**
+ * @brief Call every function in parallel, return when all are done.
+ *
+ * @attention The first function runs on the calling thread, the others on the default pool.
+ *            The first exception thrown is rethrown.
+ */
+template<typename Function, typename... Functions>
+void parallel_invoke(Function&& func, Functions&&... funcs)
+{
+    task_group group;
+    (group.run(std::ref(funcs)), ...);
+    func();  // if it throws, ~task_group() still waits for the others
+    group.wait();
+}
+
+}  // namespace mini::exec
+
+#endif
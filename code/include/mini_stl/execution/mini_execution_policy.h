@@ -0,0 +1,84 @@
+#ifndef MINI_EXECUTION_POLICY_H
+#define MINI_EXECUTION_POLICY_H
+
+#include "mini_stl/execution/mini_execution_thread_pool.h"
+
+#include <type_traits>
+
+namespace mini::exec {
+
+/**
+ * @brief Run the algorithm on the calling thread, in order.
+ */
+class sequenced_policy {};
+
+// Common part of the parallel policies: the pool pieces of the range run on
+class __parallel_policy_base {
+public:
+    constexpr __parallel_policy_base()
+        : pool_(0)
+    {}
+
+    thread_pool& pool() const { return pool_ ? *pool_ : default_thread_pool(); }
+
+protected:
+    thread_pool* pool_;  // 0 for default_thread_pool()
+};
+
+/**
+ * @brief Split the range into pieces run on a thread pool.
+ *
+ * @attention Element access functions must not race with each other: they run concurrently on
+ *            different elements.
+ * @attention An exception thrown by an element access function is rethrown to the caller (the
+ *            first one if several pieces throw), after every piece is done.
+ */
+class parallel_policy : public __parallel_policy_base {
+public:
+    // The same policy, run on 'pool' instead of default_thread_pool()
+    parallel_policy on(thread_pool& pool) const
+    {
+        parallel_policy policy(*this);
+        policy.pool_ = &pool;
+        return policy;
+    }
+};
+
+/**
+ * @brief As parallel_policy, and element access functions may also be interleaved on one thread.
+ *
+ * @attention Each piece runs a plain loop the compiler is free to vectorize. The functions must
+ *            not synchronize (no locks).
+ */
+class parallel_unsequenced_policy : public __parallel_policy_base {
+public:
+    parallel_unsequenced_policy on(thread_pool& pool) const
+    {
+        parallel_unsequenced_policy policy(*this);
+        policy.pool_ = &pool;
+        return policy;
+    }
+};
+
+inline constexpr sequenced_policy seq{};
+inline constexpr parallel_policy par{};
+inline constexpr parallel_unsequenced_policy par_unseq{};
+
+template<typename T>
+struct is_execution_policy : std::false_type {};
+
+template<>
+struct is_execution_policy<sequenced_policy> : std::true_type {};
+
+template<>
+struct is_execution_policy<parallel_policy> : std::true_type {};
+
+template<>
+struct is_execution_policy<parallel_unsequenced_policy> : std::true_type {};
+
+template<typename T>
+inline constexpr bool is_execution_policy_v = is_execution_policy<T>::value;
+
+}  // namespace mini::exec
+
+#endif
@@ -0,0 +1,407 @@
+#ifndef MINI_EXECUTION_THREAD_POOL_H
+#define MINI_EXECUTION_THREAD_POOL_H
+
+#include "mini_stl/base/mini_base_macro.h"
+#include "mini_stl/container/mini_container_deque.h"
+#include "mini_stl/container/mini_container_work_stealing_deque.h"
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <utility>
+
+namespace mini::exec {
+
+/**
+ * @brief Type-erased unit of work. Queues only move pointers to tasks.
+ */
+struct __task {
+    virtual ~__task() {}
+
+    virtual void run() = 0;
+};
+
+template<typename Function>
+struct __task_impl : __task {
+    explicit __task_impl(Function&& f)
+        : func(std::move(f))
+    {}
+
+    void run() override { func(); }
+
+    Function func;
+};
+
+class thread_pool;
+
+// Identifies the pool and the worker index of the calling thread, {0, 0} outside any pool
+struct __worker_context {
+    thread_pool* pool;
+    size_t index;
+};
+
+inline __worker_context& __current_worker()
+{
+    thread_local __worker_context context = {0, 0};
+    return context;
+}
+
+/**
+ * @brief Fixed-size pool of worker threads with per-worker work-stealing queues.
+ *
+ * @attention A task submitted from a worker goes to the bottom of that worker's own queue
+ *            (work_stealing_deque) and is usually run by the same worker, cache-warm. A task
+ *            submitted from any other thread goes to a shared injection queue.
+ * @attention An idle worker takes from its own queue, then the injection queue, then steals the
+ *            oldest task of another worker. Workers with nothing to do spin briefly, then sleep.
+ * @attention Threads waiting for a result should use wait() (or task_group::wait()), which runs
+ *            pending tasks meanwhile: blocking a worker on a future of a task queued behind it
+ *            would otherwise deadlock the pool.
+ * @attention The destructor runs every task already submitted, then joins the workers.
+ */
+class thread_pool {
+    MINI_DISALLOW_COPY_AND_MOVE(thread_pool);
+
+public:
+    typedef size_t size_type;
+
+public:
+    /**
+     * @param num_threads Number of workers, 0 for one per hardware thread
+     */
+    explicit thread_pool(size_type num_threads = 0)
+        : num_workers_(num_threads != 0 ? num_threads : default_concurrency())
+        , workers_(new worker[num_workers_])
+        , pending_(0)
+        , injected_(0)
+        , sleepers_(0)
+        , stop_(false)
+    {
+        for (size_type i = 0; i < num_workers_; ++i) {
+            workers_[i].rng = 0x9E3779B97F4A7C15ull * (i + 1);
+        }
+        for (size_type i = 0; i < num_workers_; ++i) {
+            workers_[i].thread = std::thread([this, i] { worker_loop(i); });
+        }
+    }
+
+    ~thread_pool()
+    {
+        {
+            std::lock_guard<std::mutex> lock(sleep_mutex_);
+            stop_.store(true);
+        }
+        sleep_cv_.notify_all();
+        for (size_type i = 0; i < num_workers_; ++i) {
+            workers_[i].thread.join();
+        }
+    }
+
+public:
+    size_type size() const { return num_workers_; }
+
+    /**
+     * @brief Run 'func' on the pool.
+     *
+     * @return std::future Result of 'func', or the exception it threw
+     */
+    template<typename Function>
+    std::future<std::invoke_result_t<std::decay_t<Function>>> submit(Function&& func)
+    {
+        typedef std::invoke_result_t<std::decay_t<Function>> result_type;
+        std::packaged_task<result_type()> task(std::forward<Function>(func));
+        std::future<result_type> result = task.get_future();
+        execute(std::move(task));
+        return result;
+    }
+
+    /**
+     * @brief Run 'func' on the pool, without a way to observe completion.
+     *
+     * @attention An exception escaping 'func' terminates the program.
+     */
+    template<typename Function>
+    void execute(Function&& func)
+    {
+        typedef __task_impl<std::decay_t<Function>> task_type;
+        schedule(std::unique_ptr<__task>(
+            new task_type(std::decay_t<Function>(std::forward<Function>(func)))));
+    }
+
+    /**
+     * @brief Run one pending task on the calling thread, if any can be found.
+     *
+     * @return bool true if a task was run
+     */
+    bool run_one()
+    {
+        __task* task = take(own_queue());
+        if (!task) {
+            return false;
+        }
+        run(task);
+        return true;
+    }
+
+    /**
+     * @brief Wait for 'future', running pending tasks meanwhile.
+     */
+    template<typename Future>
+    void wait(const Future& future)
+    {
+        while (future.wait_for(std::chrono::seconds(0)) != std::future_status::ready) {
+            if (!run_one()) {
+                std::this_thread::yield();
+            }
+        }
+    }
+
+    // true if the calling thread is one of this pool's workers
+    bool in_worker() const { return __current_worker().pool == this; }
+
+protected:
+    struct worker {
+        ctnr::work_stealing_deque<__task*> tasks;  // owned by 'thread'
+        std::thread thread;
+        uint64_t rng;  // victim selection state, touched by 'thread' only
+    };
+
+    // iterations of an idle worker looking for work before it sleeps
+    enum { spin_count = 64 };
+
+    static size_type default_concurrency()
+    {
+        size_type n = std::thread::hardware_concurrency();
+        return n != 0 ? n : 1;
+    }
+
+    worker* own_queue() const
+    {
+        __worker_context& context = __current_worker();
+        return context.pool == this ? &workers_[context.index] : 0;
+    }
+
+    // Queue 'task', which is destroyed and not counted if the queue cannot grow
+    void schedule(std::unique_ptr<__task> task)
+    {
+        // counted before it becomes visible, so that a taker never sees a negative count
+        pending_.fetch_add(1, std::memory_order_seq_cst);
+        try {
+            if (worker* self = own_queue()) {
+                self->tasks.push(task.get());
+            } else {
+                std::lock_guard<std::mutex> lock(injection_mutex_);
+                injection_.push_back(task.get());
+                injected_.fetch_add(1, std::memory_order_release);
+            }
+        } catch (...) {
+            pending_.fetch_sub(1, std::memory_order_relaxed);
+            throw;
+        }
+        task.release();  // owned by the queue now, and possibly run already
+        // pairs with the sleeper: either it sees pending_ > 0 or we see it sleeping
+        if (sleepers_.load(std::memory_order_seq_cst) != 0) {
+            {
+                std::lock_guard<std::mutex> lock(sleep_mutex_);
+            }
+            sleep_cv_.notify_one();
+        }
+    }
+
+    // Own queue (LIFO), then injection queue (FIFO), then steal from others (FIFO)
+    __task* take(worker* self)
+    {
+        __task* task = 0;
+        if (self && self->tasks.pop(task)) {
+            return taken(task);
+        }
+        if (injected_.load(std::memory_order_acquire) != 0) {
+            std::lock_guard<std::mutex> lock(injection_mutex_);
+            if (!injection_.empty()) {
+                task = injection_.front();
+                injection_.pop_front();
+                injected_.fetch_sub(1, std::memory_order_relaxed);
+                return taken(task);
+            }
+        }
+        size_type start = self ? size_type(next_random(self->rng) % num_workers_) : 0;
+        for (size_type i = 0; i < num_workers_; ++i) {
+            worker& victim = workers_[(start + i) % num_workers_];
+            if (&victim != self && victim.tasks.steal(task)) {
+                return taken(task);
+            }
+        }
+        return 0;
+    }
+
+    __task* taken(__task* task)
+    {
+        pending_.fetch_sub(1, std::memory_order_relaxed);
+        return task;
+    }
+
+    static void run(__task* task)
+    {
+        std::unique_ptr<__task> guard(task);
+        task->run();
+    }
+
+    static uint64_t next_random(uint64_t& state)
+    {
+        // xorshift64
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+        return state;
+    }
+
+    void worker_loop(size_type index)
+    {
+        __current_worker() = {this, index};
+        worker* self = &workers_[index];
+        for (;;) {
+            __task* task = take(self);
+            for (int i = 0; !task && i < spin_count; ++i) {
+                std::this_thread::yield();
+                task = take(self);
+            }
+            if (task) {
+                run(task);
+                continue;
+            }
+            if (stop_.load() && pending_.load() == 0) {
+                break;
+            }
+            sleep();
+        }
+        __current_worker() = {0, 0};
+    }
+
+    void sleep()
+    {
+        sleepers_.fetch_add(1, std::memory_order_seq_cst);
+        {
+            std::unique_lock<std::mutex> lock(sleep_mutex_);
+            while (pending_.load(std::memory_order_seq_cst) == 0 && !stop_.load()) {
+                sleep_cv_.wait(lock);
+            }
+        }
+        sleepers_.fetch_sub(1, std::memory_order_relaxed);
+    }
+
+protected:
+    size_type num_workers_;
+    std::unique_ptr<worker[]> workers_;
+
+    std::atomic<ptrdiff_t> pending_;  // tasks submitted and not yet taken
+
+    std::mutex injection_mutex_;
+    ctnr::deque<__task*> injection_;  // tasks submitted from outside the pool
+    std::atomic<size_type> injected_;  // size of 'injection_', read without the mutex
+
+    std::mutex sleep_mutex_;
+    std::condition_variable sleep_cv_;
+    std::atomic<int> sleepers_;  // workers inside sleep()
+    std::atomic<bool> stop_;
+};
+
+/**
+ * @brief Pool shared by the library's parallel algorithms, one worker per hardware thread.
+ */
+inline thread_pool& default_thread_pool()
+{
+    static thread_pool pool;
+    return pool;
+}
+
+/**
+ * @brief A set of tasks run on a pool and waited for together.
+ *
+ * @attention wait() runs pending tasks of the pool while the group is not done, so groups can
+ *            be nested (a task may create and wait for its own group) without deadlock.
+ * @attention The first exception thrown by a task is rethrown by wait(), the others are dropped.
+ */
+class task_group {
+    MINI_DISALLOW_COPY_AND_MOVE(task_group);
+
+public:
+    explicit task_group(thread_pool& pool = default_thread_pool())
+        : pool_(pool)
+        , pending_(0)
+        , failed_(false)
+    {}
+
+    ~task_group()
+    {
+        // tasks refer to this group: they must be done before it goes away
+        wait_noexcept();
+    }
+
+public:
+    template<typename Function>
+    void run(Function&& func)
+    {
+        pending_.fetch_add(1, std::memory_order_relaxed);
+        try {
+            pool_.execute([this, func = std::forward<Function>(func)]() mutable {
+                try {
+                    func();
+                } catch (...) {
+                    if (!failed_.exchange(true)) {
+                        exception_ = std::current_exception();
+                    }
+                }
+                // last access to the group: it may be destroyed as soon as pending_ reaches 0
+                pending_.fetch_sub(1, std::memory_order_release);
+            });
+        } catch (...) {
+            // the task was not queued: it will never finish
+            pending_.fetch_sub(1, std::memory_order_relaxed);
+            throw;
+        }
+    }
+
+    /**
+     * @brief Wait for all tasks run so far, rethrow the first exception one of them threw.
+     */
+    void wait()
+    {
+        wait_noexcept();
+        if (failed_.load()) {
+            std::exception_ptr e = exception_;
+            exception_ = nullptr;
+            failed_.store(false);
+            std::rethrow_exception(e);
+        }
+    }
+
+    thread_pool& pool() const { return pool_; }
+
+protected:
+    void wait_noexcept()
+    {
+        while (pending_.load(std::memory_order_acquire) != 0) {
+            if (!pool_.run_one()) {
+                std::this_thread::yield();
+            }
+        }
+    }
+
+protected:
+    thread_pool& pool_;
+    std::atomic<size_t> pending_;  // tasks run and not yet finished
+    std::atomic<bool> failed_;     // set by the first task that throws
+    std::exception_ptr exception_;
+};
+
+}  // namespace mini::exec
+
+#endif
@@ -28,7 +28,7 @@ struct select1st {
     template<typename T>
     constexpr auto operator()(T&& t) const -> decltype(auto)
     {
-        return std::forward<decltype(t.first)>(t.first);
+        return (std::forward<T>(t).first);
     }
 };
 
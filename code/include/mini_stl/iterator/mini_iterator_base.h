@@ -6,7 +6,7 @@
 namespace mini::iter {
 
 /**
- * @brief Five iterator categories
+ * @brief Six iterator categories
  * @attention Inheritance relationship represents relative "strongness" between each category.
  *            Weaker category(base class) can substitue stronger category, but efficiency is
  *            not guaranteed.
@@ -16,6 +16,8 @@ struct output_iterator_tag {};
 struct forward_iterator_tag : public input_iterator_tag {};
 struct bidirectional_iterator_tag : public forward_iterator_tag {};
 struct random_access_iterator_tag : public bidirectional_iterator_tag {};
+// Elements are adjacent in memory (e.g. native pointers): a range can be handled as a raw array
+struct contiguous_iterator_tag : public random_access_iterator_tag {};
 
 /**
  * @brief Standard iterator class for new iterator to inherit to ensure completeness of all associated types
@@ -49,7 +51,7 @@ struct iterator_traits {
 // Specialized version of traits class for native pointer
 template<typename T>
 struct iterator_traits<T*> {
-    typedef random_access_iterator_tag iterator_category;
+    typedef contiguous_iterator_tag iterator_category;
     typedef T value_type;
     typedef ptrdiff_t difference_type;
     typedef T* pointer;
@@ -59,11 +61,11 @@ struct iterator_traits<T*> {
 // Specialized version of traits class for native pointer-to-const
 template<typename T>
 struct iterator_traits<const T*> {
-    typedef random_access_iterator_tag iterator_category;
+    typedef contiguous_iterator_tag iterator_category;
     typedef T value_type;
     typedef ptrdiff_t difference_type;
-    typedef T* pointer;
-    typedef T& reference;
+    typedef const T* pointer;
+    typedef const T& reference;
 };
 
 // Get iterator category given an iterator
@@ -88,6 +90,19 @@ inline typename iterator_traits<Iterator>::value_type* value_type(const Iterator
     return static_cast<typename iterator_traits<Iterator>::value_type*>(0);
 }
 
+// Get the raw address an iterator refers to. Only meaningful for contiguous iterators.
+template<typename T>
+inline T* __to_address(T* ptr)
+{
+    return ptr;
+}
+
+template<typename ContiguousIterator>
+inline typename iterator_traits<ContiguousIterator>::pointer __to_address(ContiguousIterator iter)
+{
+    return &(*iter);
+}
+
 ////// distance function //////
 template<typename InputIterator>
 inline typename iterator_traits<InputIterator>::difference_type __distance(
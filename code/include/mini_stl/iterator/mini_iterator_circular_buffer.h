@@ -0,0 +1,117 @@
+#ifndef MINI_ITERATOR_CIRCULAR_BUFFER_H
+#define MINI_ITERATOR_CIRCULAR_BUFFER_H
+
+#include "mini_stl/iterator/mini_iterator_base.h"
+
+namespace mini::iter {
+
+/**
+ * @brief Iterator of circular_buffer.
+ *
+ * @attention 'pos' is a free-running logical index: it is never wrapped, the slot in the
+ *            storage is (pos & mask). Unsigned wrap-around of 'pos' is harmless because the
+ *            capacity is a power of two, so distances and slots stay correct.
+ */
+template<typename T, typename Ref, typename Ptr>
+struct __circular_buffer_iterator {
+    typedef __circular_buffer_iterator<T, T&, T*> iterator;
+    typedef __circular_buffer_iterator<T, const T&, const T*> const_iterator;
+    typedef __circular_buffer_iterator<T, Ref, Ptr> self;
+
+    typedef random_access_iterator_tag iterator_category;
+    typedef T value_type;
+    typedef Ref reference;
+    typedef Ptr pointer;
+    typedef size_t size_type;
+    typedef ptrdiff_t difference_type;
+
+    __circular_buffer_iterator()
+        : buf(0)
+        , mask(0)
+        , pos(0)
+    {}
+
+    __circular_buffer_iterator(T* buf, size_type mask, size_type pos)
+        : buf(buf)
+        , mask(mask)
+        , pos(pos)
+    {}
+
+    // iterator to const_iterator conversion
+    __circular_buffer_iterator(const iterator& other)
+        : buf(other.buf)
+        , mask(other.mask)
+        , pos(other.pos)
+    {}
+
+    // operators
+    reference operator*() const { return buf[pos & mask]; }
+
+    pointer operator->() const { return &(operator*()); }
+
+    reference operator[](difference_type n) const { return buf[(pos + n) & mask]; }
+
+    self& operator++()
+    {
+        ++pos;
+        return *this;
+    }
+
+    self operator++(int)
+    {
+        self tmp = *this;
+        ++pos;
+        return tmp;
+    }
+
+    self& operator--()
+    {
+        --pos;
+        return *this;
+    }
+
+    self operator--(int)
+    {
+        self tmp = *this;
+        --pos;
+        return tmp;
+    }
+
+    self& operator+=(difference_type n)
+    {
+        pos += n;
+        return *this;
+    }
+
+    self& operator-=(difference_type n)
+    {
+        pos -= n;
+        return *this;
+    }
+
+    self operator+(difference_type n) const { return self(buf, mask, pos + n); }
+
+    self operator-(difference_type n) const { return self(buf, mask, pos - n); }
+
+    difference_type operator-(const self& other) const { return difference_type(pos - other.pos); }
+
+    bool operator==(const self& other) const { return pos == other.pos; }
+
+    bool operator!=(const self& other) const { return pos != other.pos; }
+
+    bool operator<(const self& other) const { return (*this - other) < 0; }
+
+    bool operator>(const self& other) const { return other < *this; }
+
+    bool operator<=(const self& other) const { return !(other < *this); }
+
+    bool operator>=(const self& other) const { return !(*this < other); }
+
+    T* buf;          // storage of the owning circular_buffer
+    size_type mask;  // capacity - 1
+    size_type pos;   // logical index
+};
+
+}  // namespace mini::iter
+
+#endif
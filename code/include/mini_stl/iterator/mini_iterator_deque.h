@@ -5,6 +5,28 @@
 
 namespace mini::iter {
 
+/**
+ * @brief Buffer sizing policy of deque.
+ *
+ * @attention The default keeps the classic layout: 512 bytes per buffer, any element count.
+ * @attention Large value types should raise BlockBytes, otherwise every buffer holds one element
+ *            and the deque degrades into a map of single-element allocations.
+ * @tparam BlockBytes Target number of bytes per buffer when no explicit buffer size is given
+ * @tparam PowerOfTwo Round the element count per buffer down to a power of two, so that random
+ *                    access locates the buffer and the slot with a shift and a mask instead of a
+ *                    signed division and a modulo
+ * @tparam SpareBuffers Number of emptied buffers a deque keeps for reuse instead of freeing them,
+ *                      so that a deque used as a FIFO stops allocating once it reaches steady state
+ */
+template<size_t BlockBytes = 512, bool PowerOfTwo = false, size_t SpareBuffers = 2>
+struct deque_buffer_policy {
+    static_assert(BlockBytes > 0, "deque_buffer_policy requires a non-zero block size");
+
+    static constexpr size_t block_bytes = BlockBytes;
+    static constexpr bool power_of_two = PowerOfTwo;
+    static constexpr size_t spare_buffers = SpareBuffers;
+};
+
 /**
  * @brief Global function for determining deque buffer size.
  *
@@ -12,16 +34,56 @@ namespace mini::iter {
  * @param element_size Size of value type
  * @return size_t Buffer size, i.e., how many elements the buffer is storing
  */
-inline size_t __deque_buf_size(size_t n, size_t element_size)
+constexpr size_t __deque_buf_size(size_t n, size_t element_size)
 {
     return n != 0 ? n : (element_size < 512 ? 512 / element_size : 1);
 }
 
-template<typename T, typename Ref, typename Ptr, size_t BufferSize>
+/**
+ * @brief Global function for determining deque buffer size under a buffer sizing policy.
+ *
+ * @param n n represents user custom buffer size if not equals 0
+ * @param element_size Size of value type
+ * @param block_bytes Target number of bytes per buffer
+ * @param power_of_two Round the result down to a power of two
+ * @return size_t Buffer size, i.e., how many elements the buffer is storing
+ */
+constexpr size_t __deque_buf_size(
+    size_t n, size_t element_size, size_t block_bytes, bool power_of_two)
+{
+    size_t size = n != 0 ? n : (element_size < block_bytes ? block_bytes / element_size : 1);
+    if (power_of_two) {
+        size_t pow2 = 1;
+        while (pow2 <= size / 2) {
+            pow2 <<= 1;
+        }
+        size = pow2;
+    }
+    return size;
+}
+
+constexpr bool __is_power_of_two(size_t n)
+{
+    return n != 0 && (n & (n - 1)) == 0;
+}
+
+// log2(n) for a power of two n
+constexpr size_t __log2_power_of_two(size_t n)
+{
+    size_t shift = 0;
+    while (n > 1) {
+        n >>= 1;
+        ++shift;
+    }
+    return shift;
+}
+
+template<typename T, typename Ref, typename Ptr, size_t BufferSize,
+    typename BufferPolicy = deque_buffer_policy<>>
 struct __deque_iterator {
-    typedef __deque_iterator<T, T&, T*, BufferSize> iterator;
-    typedef __deque_iterator<T, const T&, const T*, BufferSize> const_iterator;
-    typedef __deque_iterator<T, Ref, Ptr, BufferSize> self;
+    typedef __deque_iterator<T, T&, T*, BufferSize, BufferPolicy> iterator;
+    typedef __deque_iterator<T, const T&, const T*, BufferSize, BufferPolicy> const_iterator;
+    typedef __deque_iterator<T, Ref, Ptr, BufferSize, BufferPolicy> self;
 
     typedef random_access_iterator_tag iterator_category;
     typedef T value_type;
@@ -32,7 +94,16 @@ struct __deque_iterator {
     typedef T** map_pointer;
 
     // static members
-    static size_type buffer_size() { return __deque_buf_size(BufferSize, sizeof(T)); }
+    static constexpr size_type buffer_size()
+    {
+        return __deque_buf_size(
+            BufferSize, sizeof(T), BufferPolicy::block_bytes, BufferPolicy::power_of_two);
+    }
+
+    // Power-of-two buffers (by policy, or by an explicit BufferSize) use shift/mask indexing
+    static constexpr bool power_of_two_buffer = __is_power_of_two(buffer_size());
+    static constexpr size_type buffer_shift = __log2_power_of_two(buffer_size());
+    static constexpr difference_type buffer_mask = difference_type(buffer_size()) - 1;
 
     // Connections to container
     T* cur;              // point to position just after current element in buffer zone
@@ -105,10 +176,14 @@ struct __deque_iterator {
         if (offset >= 0 && offset < difference_type(buffer_size())) {
             // target position in the same buffer
             cur += n;
+        } else if constexpr (power_of_two_buffer) {
+            // arithmetic right shift rounds toward negative infinity, as required for offset < 0
+            set_node(node + (offset >> buffer_shift));
+            cur = first + (offset & buffer_mask);
         } else {
             // target position not in same buffer
             difference_type node_offset = offset > 0
-                ? offset / difference_type(buffer_size())  // TODO: verify logic
+                ? offset / difference_type(buffer_size())
                 : -difference_type((-offset - 1) / buffer_size()) - 1;
             // move to correct buffer
             set_node(node + node_offset);
@@ -134,7 +209,16 @@ struct __deque_iterator {
     }
 
     // access value of iterator that is n distance away from this iterator
-    reference operator[](difference_type n) const { return *(*this + n); }
+    reference operator[](difference_type n) const
+    {
+        if constexpr (power_of_two_buffer) {
+            // locate buffer and slot directly, without materializing an iterator
+            difference_type offset = n + (cur - first);
+            return *(*(node + (offset >> buffer_shift)) + (offset & buffer_mask));
+        } else {
+            return *(*this + n);
+        }
+    }
 
     bool operator==(const self& other) const { return cur == other.cur; }
 
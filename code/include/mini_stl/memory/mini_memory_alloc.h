@@ -12,6 +12,7 @@
 #endif
 
 #include <cstdlib>
+#include <new>
 
 namespace mini::mem {
 
@@ -111,6 +112,32 @@ void* __malloc_alloc_template<inst>::oom_realloc(void* ptr, size_t n)
 // directly set 'inst' to 0: this non-type template paramter is not used in our case
 using malloc_alloc = __malloc_alloc_template<0>;
 
+/**
+ * @brief 1st level allocator returning blocks aligned to 'Alignment' bytes
+ * @attention Backed by the aligned forms of ::operator new/delete, throws std::bad_alloc
+ * @attention Use it for storage shared between threads, so that the storage does not share a
+ *            cache line with unrelated data
+ * @tparam Alignment Alignment in bytes, a power of two
+ */
+template<size_t Alignment>
+class __aligned_alloc_template {
+    static_assert(Alignment != 0 && (Alignment & (Alignment - 1)) == 0,
+        "alignment must be a power of two");
+
+public:
+    static void* allocate(size_t n) { return ::operator new(n, std::align_val_t(Alignment)); }
+
+    static void deallocate(void* ptr, size_t /* n */)
+    {
+        ::operator delete(ptr, std::align_val_t(Alignment));
+    }
+};
+
+// size of a cache line on mainstream x86-64 and AArch64 cores
+constexpr size_t cache_line_size = 64;
+
+using cache_aligned_alloc = __aligned_alloc_template<cache_line_size>;
+
 /**
  * @brief Sub/Second-level allocator
  * @attention Reduce fragments when allocating small memory blocks
@@ -10,6 +10,8 @@
 
 #include <algorithm>
 #include <cstring>
+#include <type_traits>
+#include <utility>
 
 namespace mini::mem {
 
@@ -71,6 +73,33 @@ inline wchar_t* uninitialized_copy(const wchar_t* first, const wchar_t* last, wc
     return result + (last - first);
 }
 
+//////////////////////////////////////////////////////////////////////////////////////
+// uninitialized_move()
+// Same as uninitialized_copy(), but elements are move constructed from the source range
+//////////////////////////////////////////////////////////////////////////////////////
+template<typename InputIterator, typename ForwardIterator>
+inline ForwardIterator uninitialized_move(
+    InputIterator first, InputIterator last, ForwardIterator result)
+{
+    typedef typename mini::iter::iterator_traits<InputIterator>::value_type T;
+    if constexpr (std::is_trivially_copyable<T>::value) {
+        return mini::mem::uninitialized_copy(first, last, result);
+    } else {
+        // commit or rollback: should a move constructor throw, the elements already built are
+        // destroyed before the exception goes on
+        ForwardIterator cur = result;
+        try {
+            for (; first != last; ++first, ++cur) {
+                construct(&(*cur), std::move(*first));
+            }
+        } catch (...) {
+            mini::mem::destroy(result, cur);
+            throw;
+        }
+        return cur;
+    }
+}
+
 //////////////////////////////////////////////////////////////////////////////////////
 // uninitialized_fill()
 //////////////////////////////////////////////////////////////////////////////////////
@@ -79,7 +108,7 @@ template<typename ForwardIterator, typename T>
 inline void __uninitialized_fill_aux(
     ForwardIterator first, ForwardIterator last, const T& value, mini::type_traits::__true_type)
 {
-    std::fill(first, last, value);
+    algo::fill(first, last, value);
 }
 
 template<typename ForwardIterator, typename T>
@@ -118,8 +147,7 @@ template<class ForwardIterator, class Size, class T>
 inline ForwardIterator __uninitialized_fill_n_aux(
     ForwardIterator first, Size n, const T& x, mini::type_traits::__true_type)
 {
-    return std::fill_n(first, n, x);
-    // return fill_n(first, n, x);  // TODO: to be implemented in chapter 6
+    return algo::fill_n(first, n, x);
 }
 
 // non-POD type
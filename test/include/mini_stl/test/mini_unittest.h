@@ -3,7 +3,11 @@
 
 #include "mini_stl/test/mini_test.h"
 
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
 #include <sstream>
+#include <vector>
 
 template<typename Container>
 std::string dump(const Container& c)
@@ -15,6 +19,64 @@ std::string dump(const Container& c)
     return ss.str().substr(0, ss.str().size() - 1);
 };
 
+// Deterministic pseudo-random generator (splitmix64): the same sequence on every platform, for
+// any seed
+class test_random {
+public:
+    explicit test_random(uint64_t seed = 12345)
+        : state_(seed)
+    {}
+
+    uint64_t operator()()
+    {
+        uint64_t z = (state_ += 0x9e3779b97f4a7c15ull);
+        z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ull;
+        z = (z ^ (z >> 27)) * 0x94d049bb133111ebull;
+        return z ^ (z >> 31);
+    }
+
+    // value in [0, range)
+    uint64_t operator()(uint64_t range) { return (*this)() % range; }
+
+private:
+    uint64_t state_;
+};
+
+// n pseudo-random values in [0, range), converted to T
+template<typename T = int>
+std::vector<T> random_values(size_t n, uint64_t range, uint64_t seed = 12345)
+{
+    test_random rng(seed);
+    std::vector<T> v;
+    v.reserve(n);
+    for (size_t i = 0; i < n; ++i) {
+        v.push_back(T(rng(range)));
+    }
+    return v;
+}
+
+// n pseudo-random values with every bit random, truncated to T
+template<typename T>
+std::vector<T> random_bits(size_t n, uint64_t seed = 12345)
+{
+    test_random rng(seed);
+    std::vector<T> v;
+    v.reserve(n);
+    for (size_t i = 0; i < n; ++i) {
+        v.push_back(T(rng()));
+    }
+    return v;
+}
+
+// random_values(), sorted: runs of equal values when 'range' is below 'n'
+template<typename T = int>
+std::vector<T> sorted_values(size_t n, uint64_t range, uint64_t seed = 12345)
+{
+    std::vector<T> v = random_values<T>(n, range, seed);
+    std::sort(v.begin(), v.end());
+    return v;
+}
+
 class mini_unittest : public ::testing::Test {
 public:
     mini_unittest() = default;
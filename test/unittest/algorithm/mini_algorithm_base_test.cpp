@@ -1,9 +1,12 @@
 #include "mini_stl/test/mini_unittest.h"
 
 #include "mini_stl/algorithm/mini_algorithm_base.h"
+#include "mini_stl/container/mini_container_deque.h"
 #include "mini_stl/container/mini_container_vector.h"
 
 #include <algorithm>
+#include <string>
+#include <type_traits>
 
 TEST(mini_algo_test, copy)
 {
@@ -13,3 +16,170 @@ TEST(mini_algo_test, copy)
     mini::algo::copy(vec1.begin(), vec1.end(), vec2.begin());
     EXPECT_TRUE(std::equal(vec1.begin(), vec1.end(), vec2.begin()));
 }
+
+// Trivial copy assignment but a user-provided destructor: not trivially copyable
+struct assignable_with_dtor {
+    ~assignable_with_dtor() {}
+    int value;
+};
+
+TEST(mini_algo_test, copy_memmove_gate)
+{
+    EXPECT_TRUE((std::is_same_v<mini::algo::__memmove_assignable<int>,
+        mini::type_traits::__true_type>));
+    EXPECT_TRUE((std::is_same_v<mini::algo::__memmove_assignable<assignable_with_dtor>,
+        mini::type_traits::__false_type>));
+
+    assignable_with_dtor src[4] = {{1}, {2}, {3}, {4}};
+    assignable_with_dtor dst[5] = {};
+    mini::algo::copy(src, src + 4, dst);
+    mini::algo::copy_backward(src, src + 4, dst + 5);
+    EXPECT_EQ(dst[0].value, 1);
+    EXPECT_EQ(dst[1].value, 1);
+    EXPECT_EQ(dst[4].value, 4);
+}
+
+TEST(mini_algo_test, contiguous_iterator_category)
+{
+    using category = mini::iter::iterator_traits<int*>::iterator_category;
+    EXPECT_TRUE((std::is_same_v<category, mini::iter::contiguous_iterator_tag>));
+    EXPECT_TRUE((std::is_base_of_v<mini::iter::random_access_iterator_tag, category>));
+}
+
+TEST(mini_algo_test, copy_fill_equal_segmented_deque)
+{
+    using deque = mini::ctnr::deque<int, mini::mem::alloc, 3>;  // 3 elements per buffer
+
+    int arr[] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+    const size_t size = sizeof(arr) / sizeof(int);
+
+    // pointer range -> deque range, across buffer boundaries
+    deque d(size, -1);
+    EXPECT_EQ(mini::algo::copy(arr, arr + size, d.begin()), d.end());
+    EXPECT_EQ(d.dump(), "0 1 2 3 4 5 6 7 8 9");
+    EXPECT_TRUE(mini::algo::equal(d.begin(), d.end(), arr));
+    EXPECT_TRUE(mini::algo::equal(arr, arr + size, d.begin()));
+
+    // deque range -> pointer range
+    int out[size] = {};
+    EXPECT_EQ(mini::algo::copy(d.begin() + 1, d.end() - 1, out), out + size - 2);
+    EXPECT_EQ(dump(out), "1 2 3 4 5 6 7 8 0 0");
+    out[0] = 42;
+    EXPECT_FALSE(mini::algo::equal(arr + 1, arr + size - 1, out));
+
+    // deque range -> deque range, buffers not aligned with each other
+    deque d2(size + 2, 0);
+    mini::algo::copy(d.begin(), d.end(), d2.begin() + 1);
+    EXPECT_EQ(d2.dump(), "0 0 1 2 3 4 5 6 7 8 9 0");
+
+    // overlapping copy_backward within a deque: shift right by 2
+    mini::algo::copy_backward(d2.begin(), d2.end() - 2, d2.end());
+    EXPECT_EQ(d2.dump(), "0 0 0 0 1 2 3 4 5 6 7 8");
+
+    // overlapping copy within a deque: shift left by 4
+    mini::algo::copy(d2.begin() + 4, d2.end(), d2.begin());
+    EXPECT_EQ(d2.dump(), "1 2 3 4 5 6 7 8 5 6 7 8");
+
+    // copy_backward from a pointer range into a deque
+    mini::algo::copy_backward(arr, arr + 5, d2.end());
+    EXPECT_EQ(d2.dump(), "1 2 3 4 5 6 7 0 1 2 3 4");
+
+    // fill / fill_n
+    mini::algo::fill(d2.begin() + 2, d2.end() - 2, 7);
+    EXPECT_EQ(d2.dump(), "1 2 7 7 7 7 7 7 7 7 3 4");
+    mini::algo::fill_n(d2.begin(), 4, 9);
+    EXPECT_EQ(d2.dump(), "9 9 9 9 7 7 7 7 7 7 3 4");
+}
+
+TEST(mini_algo_test, fill_equal_pointers)
+{
+    char buf[8];
+    mini::algo::fill(buf, buf + 7, 'x');
+    buf[7] = '\0';
+    EXPECT_STREQ(buf, "xxxxxxx");
+
+    double a[] = {0.0, 1.0, 2.0};
+    double b[] = {-0.0, 1.0, 2.0};
+    EXPECT_TRUE(mini::algo::equal(a, a + 3, b));  // +0.0 == -0.0
+
+    long x[] = {1, 2, 3};
+    const long y[] = {1, 2, 4};
+    EXPECT_TRUE(mini::algo::equal(x, x + 2, y));
+    EXPECT_FALSE(mini::algo::equal(x, x + 3, y));
+
+    // different element types compare element by element
+    const int z[] = {1, 2, 3};
+    EXPECT_TRUE(mini::algo::equal(z, z + 2, y));
+    EXPECT_FALSE(mini::algo::equal(z, z + 3, y));
+    EXPECT_TRUE(mini::algo::equal(x, x + 3, z));
+}
+
+TEST(mini_algo_test, find_count_for_each_segmented_deque)
+{
+    using deque = mini::ctnr::deque<int, mini::mem::alloc, 4>;  // 4 elements per buffer
+
+    deque d;
+    for (int i = 0; i < 14; ++i) {
+        d.push_back(i % 5);
+    }
+    d.push_front(9);
+    EXPECT_EQ(d.dump(), "9 0 1 2 3 4 0 1 2 3 4 0 1 2 3");
+
+    // find across buffers
+    auto it = mini::algo::find(d.begin(), d.end(), 4);
+    EXPECT_EQ(it - d.begin(), 5);
+    EXPECT_EQ(*it, 4);
+    it = mini::algo::find(it + 1, d.end(), 4);
+    EXPECT_EQ(it - d.begin(), 10);
+    EXPECT_EQ(mini::algo::find(d.begin(), d.end(), 7), d.end());
+    EXPECT_EQ(mini::algo::find(d.begin() + 1, d.begin() + 3, 1), d.begin() + 2);
+
+    // count across buffers
+    EXPECT_EQ(mini::algo::count(d.begin(), d.end(), 3), 3);
+    EXPECT_EQ(mini::algo::count(d.begin() + 5, d.end() - 1, 3), 1);
+    EXPECT_EQ(mini::algo::count(d.begin(), d.begin(), 3), 0);
+
+    // for_each with a temporary function object
+    EXPECT_EQ(mini::algo::for_each(d.begin(), d.end(), [](int& e) { e *= 2; }), d.end());
+    EXPECT_EQ(d.dump(), "18 0 2 4 6 8 0 2 4 6 8 0 2 4 6");
+
+    // for_each with a stateful function object passed as an lvalue
+    struct summer {
+        void operator()(int e) { sum += e; }
+        int sum = 0;
+    } s;
+    mini::algo::for_each(d.begin() + 1, d.end(), s);
+    EXPECT_EQ(s.sum, 52);
+}
+
+// An element without a default constructor
+struct no_default {
+    explicit no_default(int v)
+        : value(v)
+    {}
+
+    bool operator==(const no_default& other) const { return value == other.value; }
+    bool operator!=(const no_default& other) const { return value != other.value; }
+
+    int value;
+};
+
+TEST(mini_algo_test, find_count_non_arithmetic)
+{
+    // not vectorized: the pointer path falls back to the plain loop
+    mini::ctnr::vector<std::string> words;
+    for (const char* w : {"tree", "leaf", "root", "leaf"}) {
+        words.push_back(w);
+    }
+    EXPECT_EQ(mini::algo::find(words.begin(), words.end(), std::string("root")) - words.begin(), 2);
+    EXPECT_EQ(mini::algo::find(words.begin(), words.end(), std::string("bark")), words.end());
+    EXPECT_EQ(mini::algo::count(words.begin(), words.end(), std::string("leaf")), 2);
+
+    mini::ctnr::deque<no_default, mini::mem::alloc, 4> d;
+    for (int i = 0; i < 10; ++i) {
+        d.push_back(no_default(i % 3));
+    }
+    EXPECT_EQ(mini::algo::find(d.begin(), d.end(), no_default(2)) - d.begin(), 2);
+    EXPECT_EQ(mini::algo::find(d.begin(), d.end(), no_default(5)), d.end());
+    EXPECT_EQ(mini::algo::count(d.begin(), d.end(), no_default(0)), 4);
+}
@@ -2,6 +2,12 @@
 
 #include "mini_stl/algorithm/mini_algorithm.h"
 
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
 TEST(mini_algo_test, heap_test_std_vector)
 {
     // Use std::vector as underlying container
@@ -35,3 +41,95 @@ TEST(mini_algo_test, heap_test_array)
     mini::algo::sort_heap(v, v + size);
     EXPECT_EQ(dump(v), "0 1 2 3 3 4 5 8 9");
 }
+
+TEST(mini_algo_test, heap_test_compare)
+{
+    // a min-heap with greater<>
+    std::vector<int> v{5, 1, 4, 2, 3};
+    mini::algo::make_heap(v.begin(), v.end(), mini::func::greater<int>());
+    EXPECT_EQ(v.front(), 1);
+
+    v.push_back(0);
+    mini::algo::push_heap(v.begin(), v.end(), mini::func::greater<int>());
+    EXPECT_EQ(v.front(), 0);
+
+    mini::algo::pop_heap(v.begin(), v.end(), mini::func::greater<int>());
+    EXPECT_EQ(v.back(), 0);
+    v.pop_back();
+    EXPECT_EQ(v.front(), 1);
+
+    // sorted in decreasing order
+    mini::algo::sort_heap(v.begin(), v.end(), mini::func::greater<int>());
+    EXPECT_EQ(dump(v), "5 4 3 2 1");
+}
+
+namespace {
+
+// Whether [first, last) is an Arity-ary heap ordered by 'comp'
+template<size_t Arity, typename T, typename Compare>
+bool is_dary_heap(const T* first, const T* last, Compare comp)
+{
+    for (ptrdiff_t i = 1; i < last - first; ++i) {
+        if (comp(first[(i - 1) / ptrdiff_t(Arity)], first[i])) {
+            return false;
+        }
+    }
+    return true;
+}
+
+template<size_t Arity>
+void check_dary_heap()
+{
+    for (size_t n : {0, 1, 2, 3, 4, 5, 6, 17, 100, 1000}) {
+        std::vector<int> v = random_values(n, 50, n + Arity);
+        std::vector<int> sorted(v);
+        std::sort(sorted.begin(), sorted.end());
+
+        mini::algo::make_dary_heap<Arity>(v.data(), v.data() + n);
+        ASSERT_TRUE(is_dary_heap<Arity>(v.data(), v.data() + n, std::less<int>())) << n;
+
+        // pop half, push them back
+        for (size_t i = n; i > n / 2; --i) {
+            mini::algo::pop_dary_heap<Arity>(v.data(), v.data() + i);
+            ASSERT_EQ(v[i - 1], sorted[i - 1]) << n;
+            ASSERT_TRUE(is_dary_heap<Arity>(v.data(), v.data() + i - 1, std::less<int>())) << n;
+        }
+        for (size_t i = n / 2; i < n; ++i) {
+            mini::algo::push_dary_heap<Arity>(v.data(), v.data() + i + 1);
+            ASSERT_TRUE(is_dary_heap<Arity>(v.data(), v.data() + i + 1, std::less<int>())) << n;
+        }
+
+        mini::algo::sort_dary_heap<Arity>(v.data(), v.data() + n);
+        ASSERT_EQ(v, sorted) << n;
+
+        // min-heap
+        mini::algo::make_dary_heap<Arity>(v.data(), v.data() + n, mini::func::greater<int>());
+        ASSERT_TRUE(is_dary_heap<Arity>(v.data(), v.data() + n, std::greater<int>())) << n;
+        mini::algo::sort_dary_heap<Arity>(v.data(), v.data() + n, mini::func::greater<int>());
+        std::reverse(sorted.begin(), sorted.end());
+        ASSERT_EQ(v, sorted) << n;
+    }
+}
+
+}  // namespace
+
+TEST(mini_algo_test, heap_test_dary)
+{
+    check_dary_heap<2>();
+    check_dary_heap<3>();
+    check_dary_heap<4>();
+    check_dary_heap<8>();
+
+    // moves only: std::string elements keep their values
+    std::vector<std::string> s = {"d", "a", "c", "e", "b"};
+    mini::algo::make_dary_heap(s.data(), s.data() + s.size());
+    EXPECT_EQ(s.front(), "e");
+    mini::algo::pop_dary_heap(s.data(), s.data() + s.size());
+    EXPECT_EQ(s.back(), "e");
+    s.pop_back();
+    s.push_back("f");
+    mini::algo::push_dary_heap(s.data(), s.data() + s.size());
+    EXPECT_EQ(s.front(), "f");
+    mini::algo::sort_dary_heap(s.data(), s.data() + s.size());
+    EXPECT_EQ(dump(s), "a b c d f");
+}
@@ -0,0 +1,236 @@
+#include "mini_stl/test/mini_unittest.h"
+
+#include "mini_stl/algorithm/mini_algorithm.h"
+#include "mini_stl/container/mini_container_deque.h"
+#include "mini_stl/container/mini_container_list.h"
+#include "mini_stl/container/mini_container_vector.h"
+#include "mini_stl/iterator/mini_iterator.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace {
+
+// Deterministic sorted sequence in [offset, offset + range)
+std::vector<int> sorted_ints(size_t n, uint32_t range, uint32_t seed, int offset = 0)
+{
+    std::vector<int> v = sorted_values(n, range, seed);
+    for (int& x : v) {
+        x += offset;
+    }
+    return v;
+}
+
+// Element whose tag tells where it comes from, ordered by key only
+struct tagged {
+    int key;
+    int tag;
+};
+
+struct key_less {
+    size_t* comparisons;
+
+    bool operator()(const tagged& x, const tagged& y) const
+    {
+        ++*comparisons;
+        return x.key < y.key;
+    }
+};
+
+// Sorted by key, then by tag: what a stable merge of runs tagged in order must produce
+bool stable_order(const std::vector<tagged>& v)
+{
+    for (size_t i = 1; i < v.size(); ++i) {
+        if (v[i].key < v[i - 1].key || (v[i].key == v[i - 1].key && v[i].tag < v[i - 1].tag)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+std::vector<tagged> tag(const std::vector<int>& keys, int t)
+{
+    std::vector<tagged> v;
+    for (int key : keys) {
+        v.push_back(tagged{key, t});
+    }
+    return v;
+}
+
+}  // namespace
+
+TEST(mini_algo_test, merge_two_way)
+{
+    // balanced, skewed in length, disjoint, interleaved in blocks
+    const std::pair<std::vector<int>, std::vector<int>> cases[] = {
+        {{}, {}},
+        {{}, {1, 2}},
+        {{3}, {}},
+        {sorted_ints(500, 100, 1), sorted_ints(700, 100, 2)},
+        {sorted_ints(5000, 100000, 3), sorted_ints(3, 100000, 4)},
+        {sorted_ints(1000, 1000, 5), sorted_ints(1000, 1000, 6, 1000)},
+        {sorted_ints(1000, 1000, 7, 1000), sorted_ints(1000, 1000, 8)},
+        {sorted_ints(2000, 20, 9), sorted_ints(2000, 20, 10)},
+    };
+    for (const auto& c : cases) {
+        const std::vector<int>& a = c.first;
+        const std::vector<int>& b = c.second;
+        std::vector<int> expected(a.size() + b.size());
+        std::merge(a.begin(), a.end(), b.begin(), b.end(), expected.begin());
+
+        std::vector<int> out(expected.size());
+        int* end = mini::algo::merge(
+            a.data(), a.data() + a.size(), b.data(), b.data() + b.size(), out.data());
+        EXPECT_EQ(end, out.data() + out.size());
+        EXPECT_EQ(out, expected);
+
+        std::fill(out.begin(), out.end(), -1);
+        end = mini::algo::gallop_merge(
+            a.data(), a.data() + a.size(), b.data(), b.data() + b.size(), out.data());
+        EXPECT_EQ(end, out.data() + out.size());
+        EXPECT_EQ(out, expected);
+
+        // stable: equal keys of the first range first
+        std::vector<tagged> ta = tag(a, 0), tb = tag(b, 1);
+        std::vector<tagged> merged(ta.size() + tb.size());
+        size_t comparisons = 0;
+        mini::algo::gallop_merge(ta.data(), ta.data() + ta.size(), tb.data(),
+            tb.data() + tb.size(), merged.data(), key_less{&comparisons});
+        EXPECT_TRUE(stable_order(merged));
+        mini::algo::merge(ta.data(), ta.data() + ta.size(), tb.data(), tb.data() + tb.size(),
+            merged.data(), key_less{&comparisons});
+        EXPECT_TRUE(stable_order(merged));
+    }
+
+    // other iterators, into a back inserter
+    mini::ctnr::list<int> l;
+    mini::ctnr::deque<int> d;
+    for (int x : {1, 3, 5, 7}) {
+        l.push_back(x);
+    }
+    for (int x : {2, 3, 4, 8, 9}) {
+        d.push_back(x);
+    }
+    mini::ctnr::vector<int> out;
+    mini::algo::gallop_merge(
+        l.begin(), l.end(), d.begin(), d.end(), mini::iter::back_inserter(out));
+    EXPECT_EQ(dump(out), "1 2 3 3 4 5 7 8 9");
+    out.clear();
+    mini::algo::gallop_merge(
+        d.begin(), d.end(), d.begin(), d.end(), mini::iter::back_inserter(out));
+    EXPECT_EQ(dump(out), "2 2 3 3 4 4 8 8 9 9");
+}
+
+TEST(mini_algo_test, gallop_merge_comparisons)
+{
+    // a short range spread over a long one: blocks of the long range are skipped
+    std::vector<tagged> a = tag(sorted_ints(100000, 1000000, 11), 0);
+    std::vector<tagged> b = tag(sorted_ints(100, 1000000, 12), 1);
+    std::vector<tagged> out(a.size() + b.size());
+    size_t linear = 0;
+    size_t galloping = 0;
+    mini::algo::merge(a.data(), a.data() + a.size(), b.data(), b.data() + b.size(), out.data(),
+        key_less{&linear});
+    mini::algo::gallop_merge(a.data(), a.data() + a.size(), b.data(), b.data() + b.size(),
+        out.data(), key_less{&galloping});
+    EXPECT_TRUE(stable_order(out));
+    EXPECT_GT(linear, 90000);
+    EXPECT_LT(galloping, 5000);
+
+    // disjoint ranges: one gallop over each
+    a = tag(sorted_ints(10000, 1000, 13), 0);
+    b = tag(sorted_ints(10000, 1000, 14, 1000), 1);
+    galloping = 0;
+    mini::algo::gallop_merge(a.data(), a.data() + a.size(), b.data(), b.data() + b.size(),
+        out.data(), key_less{&galloping});
+    EXPECT_LT(galloping, 100);
+}
+
+TEST(mini_algo_test, merge_k_way)
+{
+    for (size_t k : {0, 1, 2, 3, 5, 8, 13, 100}) {
+        mini::ctnr::vector<mini::ctnr::deque<int>> runs(k);
+        std::vector<int> expected;
+        for (size_t i = 0; i < k; ++i) {
+            // some runs empty, lengths differ
+            for (int x : sorted_ints(i % 4 == 3 ? 0 : 10 * i + 1, 300, uint32_t(i))) {
+                runs[i].push_back(x);
+                expected.push_back(x);
+            }
+        }
+        std::sort(expected.begin(), expected.end());
+
+        std::vector<int> out(expected.size());
+        int* end = mini::algo::merge(runs.begin(), runs.end(), out.data());
+        EXPECT_EQ(end, out.data() + out.size()) << k;
+        EXPECT_EQ(out, expected) << k;
+    }
+
+    // runs as pairs of pointers, with a comparator
+    std::vector<int> a = {9, 7, 7, 1};
+    std::vector<int> b = {8, 7, 2};
+    std::vector<int> c = {10, 0};
+    typedef mini::util::pair<const int*, const int*> run;
+    run runs[] = {run(a.data(), a.data() + a.size()), run(b.data(), b.data() + b.size()),
+        run(c.data(), c.data() + c.size())};
+    mini::ctnr::vector<int> out;
+    mini::algo::merge(runs, runs + 3, mini::iter::back_inserter(out), mini::func::greater<int>());
+    EXPECT_EQ(dump(out), "10 9 8 7 7 7 2 1 0");
+}
+
+TEST(mini_algo_test, loser_tree_stream)
+{
+    // stable across runs, ceil(log2 k) comparisons per element
+    const size_t k = 37;
+    std::vector<std::vector<tagged>> runs;
+    size_t total = 0;
+    for (size_t i = 0; i < k; ++i) {
+        runs.push_back(tag(sorted_ints(200 + i, 50, uint32_t(i + 100)), int(i)));
+        total += runs.back().size();
+    }
+    typedef mini::util::pair<const tagged*, const tagged*> run;
+    std::vector<run> bounds;
+    for (const auto& r : runs) {
+        bounds.push_back(run(r.data(), r.data() + r.size()));
+    }
+
+    size_t comparisons = 0;
+    mini::algo::loser_tree<const tagged*, key_less> tree(
+        bounds.data(), bounds.data() + bounds.size(), key_less{&comparisons});
+    EXPECT_EQ(tree.live_runs(), k);
+    const size_t build_comparisons = comparisons;
+    EXPECT_LE(build_comparisons, k - 1);
+
+    std::vector<tagged> out;
+    while (!tree.empty()) {
+        EXPECT_EQ(size_t(tree.top().tag), tree.top_run());
+        out.push_back(tree.top());
+        tree.pop();
+    }
+    EXPECT_EQ(out.size(), total);
+    EXPECT_TRUE(stable_order(out));
+    EXPECT_LE(comparisons - build_comparisons, total * 6);  // ceil(log2 37) == 6
+
+    // pull a few, then drain the rest
+    mini::algo::loser_tree<const tagged*, key_less> again(
+        bounds.data(), bounds.data() + bounds.size(), key_less{&comparisons});
+    std::vector<tagged> drained;
+    for (int i = 0; i < 100; ++i) {
+        drained.push_back(again.top());
+        again.pop();
+    }
+    drained.resize(total);
+    again.drain(drained.data() + 100);
+    EXPECT_TRUE(again.empty());
+    EXPECT_TRUE(stable_order(drained));
+
+    // nothing to merge
+    mini::ctnr::vector<mini::ctnr::vector<int>> none;
+    mini::algo::loser_tree<mini::ctnr::vector<int>::iterator> empty_tree(none.begin(), none.end());
+    EXPECT_TRUE(empty_tree.empty());
+    none.push_back(mini::ctnr::vector<int>());
+    mini::algo::loser_tree<mini::ctnr::vector<int>::iterator> empty_run(none.begin(), none.end());
+    EXPECT_TRUE(empty_run.empty());
+}
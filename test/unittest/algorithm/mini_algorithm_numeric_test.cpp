@@ -0,0 +1,32 @@
+#include "mini_stl/test/mini_unittest.h"
+
+#include "mini_stl/algorithm/mini_algorithm.h"
+#include "mini_stl/container/mini_container_deque.h"
+#include "mini_stl/container/mini_container_vector.h"
+#include "mini_stl/functional/mini_functional.h"
+
+TEST(mini_algo_test, accumulate)
+{
+    {
+        int arr[] = {1, 2, 3, 4, 5};
+        EXPECT_EQ(mini::algo::accumulate(arr, arr + 5, 0), 15);
+        EXPECT_EQ(mini::algo::accumulate(arr, arr + 5, 10, mini::func::minus<int>()), -5);
+        EXPECT_EQ(mini::algo::accumulate(arr, arr, 7), 7);
+    }
+
+    {
+        // deque range is folded buffer by buffer, in order
+        using deque = mini::ctnr::deque<int, mini::mem::alloc, 3>;
+        deque d;
+        for (int i = 1; i <= 10; ++i) {
+            d.push_back(i);
+        }
+        EXPECT_EQ(mini::algo::accumulate(d.begin(), d.end(), 0), 55);
+        EXPECT_EQ(mini::algo::accumulate(d.begin() + 2, d.begin() + 4, 0), 7);
+        EXPECT_EQ(mini::algo::accumulate(d.begin(), d.end(), 0L, [](long acc, int e) {
+            return acc * 2 + e;
+        }),
+            2036);
+        EXPECT_EQ(mini::algo::accumulate(d.begin(), d.end(), 0.5), 55.5);
+    }
+}
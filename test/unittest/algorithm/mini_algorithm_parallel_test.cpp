@@ -0,0 +1,277 @@
+#include "mini_stl/test/mini_unittest.h"
+
+#include "mini_stl/algorithm/mini_algorithm_parallel.h"
+#include "mini_stl/container/mini_container_deque.h"
+#include "mini_stl/container/mini_container_vector.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace {
+
+// Large enough to be cut into several pieces
+const int parallel_size = 100000;
+
+mini::exec::thread_pool& test_pool()
+{
+    static mini::exec::thread_pool pool(4);
+    return pool;
+}
+
+// Counts live objects; the move constructor throws once 'moves_left' runs out
+struct move_limited {
+    static std::atomic<int> live;
+    static std::atomic<int> moves_left;
+
+    int key;
+
+    explicit move_limited(int k)
+        : key(k)
+    {
+        ++live;
+    }
+    move_limited(move_limited&& other)
+        : key(other.key)
+    {
+        if (moves_left.fetch_sub(1) <= 0) {
+            throw std::runtime_error("move");
+        }
+        ++live;
+    }
+    move_limited& operator=(move_limited&&) = default;
+    ~move_limited() { --live; }
+
+    bool operator<(const move_limited& other) const { return key < other.key; }
+};
+
+std::atomic<int> move_limited::live(0);
+std::atomic<int> move_limited::moves_left(0);
+
+}  // namespace
+
+TEST(mini_algo_test, execution_policy_traits)
+{
+    EXPECT_TRUE(mini::exec::is_execution_policy_v<mini::exec::sequenced_policy>);
+    EXPECT_TRUE(mini::exec::is_execution_policy_v<mini::exec::parallel_policy>);
+    EXPECT_TRUE(mini::exec::is_execution_policy_v<mini::exec::parallel_unsequenced_policy>);
+    EXPECT_FALSE(mini::exec::is_execution_policy_v<int>);
+    EXPECT_EQ(&mini::exec::par.pool(), &mini::exec::default_thread_pool());
+    EXPECT_EQ(&mini::exec::par.on(test_pool()).pool(), &test_pool());
+}
+
+TEST(mini_algo_test, parallel_for_each_and_fill)
+{
+    const auto par = mini::exec::par.on(test_pool());
+
+    mini::ctnr::vector<int> v(parallel_size, 0);
+    mini::algo::fill(par, v.begin(), v.end(), 3);
+    mini::algo::for_each(par, v.begin(), v.end(), [](int& x) { x *= 2; });
+    EXPECT_EQ(mini::algo::count(v.begin(), v.end(), 6), parallel_size);
+
+    // every element visited exactly once
+    std::atomic<long> visits(0);
+    mini::algo::for_each(par, v.begin(), v.end(), [&visits](int) { visits.fetch_add(1); });
+    EXPECT_EQ(visits.load(), parallel_size);
+
+    // deque pieces cross buffer boundaries
+    mini::ctnr::deque<int> d(parallel_size, 1);
+    mini::algo::fill(par, d.begin() + 1, d.end() - 1, 7);
+    EXPECT_EQ(d.front(), 1);
+    EXPECT_EQ(d.back(), 1);
+    EXPECT_EQ(mini::algo::count(d.begin(), d.end(), 7), parallel_size - 2);
+
+    // sequential policy and small ranges
+    int arr[] = {1, 2, 3};
+    mini::algo::for_each(mini::exec::seq, arr, arr + 3, [](int& x) { ++x; });
+    mini::algo::fill(mini::exec::par_unseq, arr, arr + 1, 0);
+    EXPECT_EQ(arr[0], 0);
+    EXPECT_EQ(arr[1], 3);
+    EXPECT_EQ(arr[2], 4);
+}
+
+TEST(mini_algo_test, parallel_transform_and_copy)
+{
+    const auto par = mini::exec::par.on(test_pool());
+
+    mini::ctnr::vector<int> v(parallel_size, 0);
+    for (int i = 0; i < parallel_size; ++i) {
+        v[i] = i;
+    }
+
+    mini::ctnr::deque<long> d(parallel_size, 0);
+    auto end = mini::algo::transform(
+        par, v.begin(), v.end(), d.begin(), [](int x) { return long(x) * 3; });
+    EXPECT_TRUE(end == d.end());
+    for (int i = 0; i < parallel_size; i += 997) {
+        EXPECT_EQ(d[i], long(i) * 3);
+    }
+
+    mini::ctnr::vector<long> w(parallel_size, 0);
+    mini::algo::transform(par, v.begin(), v.end(), d.begin(), w.begin(),
+        [](int x, long y) { return y - x; });
+    EXPECT_EQ(w[parallel_size - 1], 2L * (parallel_size - 1));
+
+    mini::ctnr::vector<long> c(parallel_size, 0);
+    EXPECT_TRUE(mini::algo::copy(par, d.begin(), d.end(), c.begin()) == c.end());
+    EXPECT_EQ(c[12345], 12345L * 3);
+    EXPECT_EQ(c[parallel_size - 1], long(parallel_size - 1) * 3);
+
+    // output into a deque, the pieces land at the right offsets
+    mini::ctnr::deque<long> e(parallel_size, 0);
+    mini::algo::copy(mini::exec::par_unseq.on(test_pool()), c.begin(), c.end(), e.begin());
+    EXPECT_EQ(e[54321], 54321L * 3);
+
+    // exceptions reach the caller
+    EXPECT_THROW(mini::algo::for_each(par, v.begin(), v.end(),
+                     [](int x) {
+                         if (x == parallel_size / 2) {
+                             throw std::runtime_error("element");
+                         }
+                     }),
+        std::runtime_error);
+}
+
+TEST(mini_algo_test, parallel_reduce)
+{
+    const auto par = mini::exec::par.on(test_pool());
+
+    mini::ctnr::vector<long> v(parallel_size, 0);
+    for (int i = 0; i < parallel_size; ++i) {
+        v[i] = i + 1;
+    }
+    const long sum = long(parallel_size) * (parallel_size + 1) / 2;
+
+    EXPECT_EQ(mini::algo::reduce(v.begin(), v.end()), sum);
+    EXPECT_EQ(mini::algo::reduce(par, v.begin(), v.end()), sum);
+    EXPECT_EQ(mini::algo::reduce(par, v.begin(), v.end(), 10L), sum + 10);
+    EXPECT_EQ(mini::algo::reduce(mini::exec::seq, v.begin(), v.end(), 10L), sum + 10);
+    EXPECT_EQ(mini::algo::reduce(
+                  par, v.begin(), v.end(), 0L, [](long x, long y) { return x > y ? x : y; }),
+        parallel_size);
+
+    // segmented deque range
+    mini::ctnr::deque<long> d(parallel_size, 2);
+    EXPECT_EQ(mini::algo::reduce(par, d.begin() + 3, d.end(), 0L), 2L * (parallel_size - 3));
+
+    // floating point: the grouping is fixed, so runs agree with each other
+    mini::ctnr::vector<double> f(parallel_size, 0.1);
+    const double first_run = mini::algo::reduce(par, f.begin(), f.end(), 0.0);
+    EXPECT_EQ(mini::algo::reduce(par, f.begin(), f.end(), 0.0), first_run);
+    EXPECT_NEAR(first_run, parallel_size * 0.1, 1e-6);
+
+    // transform_reduce: sum of squares and inner product
+    EXPECT_EQ(mini::algo::transform_reduce(
+                  par, d.begin(), d.end(), 0L, [](long x, long y) { return x + y; },
+                  [](long x) { return x * x; }),
+        4L * parallel_size);
+    EXPECT_EQ(mini::algo::transform_reduce(par, v.begin(), v.end(), d.begin(), 0L), 2 * sum);
+    EXPECT_EQ(mini::algo::transform_reduce(v.begin(), v.end(), d.begin(), 0L), 2 * sum);
+
+    int arr[] = {1, 2, 3};
+    EXPECT_EQ(mini::algo::transform_reduce(arr, arr + 3, 0, [](int x, int y) { return x + y; },
+                  [](int x) { return -x; }),
+        -6);
+    EXPECT_EQ(mini::algo::reduce(par, arr, arr, 5), 5);
+}
+
+TEST(mini_algo_test, parallel_sort)
+{
+    const auto par = mini::exec::par.on(test_pool());
+    test_random rng(1);
+
+    mini::ctnr::vector<int> v(parallel_size, 0);
+    for (int& x : v) {
+        x = int(rng(1000000));
+    }
+    std::vector<int> expected(v.begin(), v.end());
+    std::sort(expected.begin(), expected.end());
+    mini::algo::sort(par, v.begin(), v.end());
+    EXPECT_TRUE(std::equal(v.begin(), v.end(), expected.begin()));
+
+    // descending order, already sorted input
+    mini::algo::sort(par, v.begin(), v.end(), mini::func::greater<int>());
+    EXPECT_TRUE(std::equal(v.begin(), v.end(), expected.rbegin()));
+
+    // deque: runs and merges cross buffer boundaries; few distinct values
+    mini::ctnr::deque<int> d;
+    std::vector<int> expected_d;
+    for (int i = 0; i < parallel_size + 7; ++i) {
+        d.push_back(int(rng(5)));
+        expected_d.push_back(d.back());
+    }
+    std::sort(expected_d.begin() + 1, expected_d.end());
+    mini::algo::sort(par, d.begin() + 1, d.end());
+    EXPECT_TRUE(std::equal(d.begin(), d.end(), expected_d.begin()));
+
+    // non-trivial elements go through a buffer of moved elements
+    std::vector<std::string> s;
+    for (int i = 0; i < parallel_size / 2; ++i) {
+        s.push_back(std::to_string(int(rng(100000))));
+    }
+    std::vector<std::string> expected_s(s);
+    std::sort(expected_s.begin(), expected_s.end());
+    mini::algo::sort(par, s.data(), s.data() + s.size());
+    EXPECT_EQ(s, expected_s);
+
+    // sequential policy and small ranges
+    mini::ctnr::vector<int> small(3, 0);
+    small[0] = 3;
+    small[1] = 1;
+    small[2] = 2;
+    mini::algo::sort(mini::exec::seq, small.begin(), small.end());
+    EXPECT_EQ(dump(small), "1 2 3");
+    mini::algo::sort(par, small.begin(), small.end(), mini::func::greater<int>());
+    EXPECT_EQ(dump(small), "3 2 1");
+}
+
+TEST(mini_algo_test, parallel_stable_sort)
+{
+    const auto par = mini::exec::par.on(test_pool());
+    test_random rng(7);
+
+    // (key, original position): equal keys must keep their positions in order
+    mini::ctnr::vector<std::pair<int, int>> v;
+    for (int i = 0; i < parallel_size; ++i) {
+        v.push_back(std::make_pair(int(rng(100)), i));
+    }
+    auto by_key = [](const std::pair<int, int>& x, const std::pair<int, int>& y) {
+        return x.first < y.first;
+    };
+    mini::algo::stable_sort(par, v.begin(), v.end(), by_key);
+    for (int i = 1; i < parallel_size; ++i) {
+        ASSERT_TRUE(v[i - 1].first < v[i].first ||
+                    (v[i - 1].first == v[i].first && v[i - 1].second < v[i].second));
+    }
+
+    mini::ctnr::deque<int> d;
+    for (int i = 0; i < parallel_size; ++i) {
+        d.push_back(int(rng(1000)));
+    }
+    mini::algo::stable_sort(par, d.begin(), d.end());
+    EXPECT_TRUE(std::is_sorted(d.begin(), d.end()));
+}
+
+TEST(mini_algo_test, parallel_sort_exception)
+{
+    const auto par = mini::exec::par.on(test_pool());
+    test_random rng(40);
+    {
+        std::vector<move_limited> v;
+        v.reserve(parallel_size);
+        for (int i = 0; i < parallel_size; ++i) {
+            v.emplace_back(int(rng(1000)));
+        }
+        // fails while the pieces move the elements into the buffer: the pieces already moved
+        // are destroyed again
+        move_limited::moves_left = parallel_size / 2;
+        EXPECT_THROW(
+            mini::algo::stable_sort(par, v.data(), v.data() + v.size()), std::runtime_error);
+        EXPECT_EQ(move_limited::live.load(), parallel_size);
+    }
+    EXPECT_EQ(move_limited::live.load(), 0);
+}
@@ -0,0 +1,232 @@
+#include "mini_stl/test/mini_unittest.h"
+
+#include "mini_stl/algorithm/mini_algorithm.h"
+#include "mini_stl/algorithm/mini_algorithm_parallel.h"
+#include "mini_stl/container/mini_container_deque.h"
+#include "mini_stl/container/mini_container_vector.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace {
+
+struct record {
+    int32_t key;
+    std::string payload;  // original position, checks stability and that payloads follow keys
+};
+
+// Counts live objects; the move constructor throws once 'moves_left' runs out
+struct move_limited {
+    static std::atomic<int> live;
+    static std::atomic<int> moves_left;
+
+    int32_t key;
+
+    explicit move_limited(int32_t k)
+        : key(k)
+    {
+        ++live;
+    }
+    move_limited(const move_limited& other)
+        : key(other.key)
+    {
+        ++live;
+    }
+    move_limited(move_limited&& other)
+        : key(other.key)
+    {
+        if (moves_left.fetch_sub(1) <= 0) {
+            throw std::runtime_error("move");
+        }
+        ++live;
+    }
+    move_limited& operator=(const move_limited&) = default;
+    move_limited& operator=(move_limited&&) = default;
+    ~move_limited() { --live; }
+};
+
+std::atomic<int> move_limited::live(0);
+std::atomic<int> move_limited::moves_left(0);
+
+}  // namespace
+
+TEST(mini_algo_test, radix_sort_integers)
+{
+    std::vector<uint64_t> u = random_bits<uint64_t>(5000);
+    std::vector<uint64_t> expected(u);
+    std::sort(expected.begin(), expected.end());
+    mini::algo::radix_sort(u.data(), u.data() + u.size());
+    EXPECT_EQ(u, expected);
+
+    // signed keys, negative values first
+    std::vector<int32_t> s = random_bits<int32_t>(3000);
+    s.push_back(std::numeric_limits<int32_t>::min());
+    s.push_back(std::numeric_limits<int32_t>::max());
+    s.push_back(0);
+    std::vector<int32_t> expected_s(s);
+    std::sort(expected_s.begin(), expected_s.end());
+    std::vector<int32_t> lsd(s);
+    mini::algo::radix_sort(lsd.data(), lsd.data() + lsd.size());
+    EXPECT_EQ(lsd, expected_s);
+    std::vector<int32_t> msd(s);
+    mini::algo::radix_sort_msd(msd.data(), msd.data() + msd.size());
+    EXPECT_EQ(msd, expected_s);
+
+    // small key range: most passes are skipped
+    std::vector<uint64_t> small(2000);
+    for (size_t i = 0; i < small.size(); ++i) {
+        small[i] = (i * 7919) % 300;
+    }
+    mini::algo::radix_sort(small.data(), small.data() + small.size());
+    EXPECT_TRUE(std::is_sorted(small.begin(), small.end()));
+
+    // 8 and 16-bit keys, short ranges
+    std::vector<uint8_t> bytes = random_bits<uint8_t>(1000);
+    mini::algo::radix_sort_msd(bytes.data(), bytes.data() + bytes.size());
+    EXPECT_TRUE(std::is_sorted(bytes.begin(), bytes.end()));
+    int16_t few[] = {3, -1, 2};
+    mini::algo::radix_sort(few, few + 3);
+    EXPECT_EQ(dump(few), "-1 2 3");
+
+    // deque iterators
+    mini::ctnr::deque<uint32_t> d;
+    for (uint32_t x : random_bits<uint32_t>(4000)) {
+        d.push_back(x);
+    }
+    mini::algo::radix_sort(d.begin(), d.end());
+    EXPECT_TRUE(std::is_sorted(d.begin(), d.end()));
+}
+
+TEST(mini_algo_test, radix_sort_msd_skewed)
+{
+    // most keys share their high bytes, a few buckets hold nearly everything
+    std::vector<uint64_t> v = random_bits<uint64_t>(20000);
+    for (size_t i = 0; i < v.size(); ++i) {
+        v[i] = i % 10 == 0 ? v[i] : 0x1234567800000000ull + (v[i] & 0xFFF);
+    }
+    std::vector<uint64_t> expected(v);
+    std::sort(expected.begin(), expected.end());
+    mini::algo::radix_sort_msd(v.data(), v.data() + v.size());
+    EXPECT_EQ(v, expected);
+
+    std::vector<uint64_t> same(500, 42);
+    mini::algo::radix_sort_msd(same.data(), same.data() + same.size());
+    EXPECT_EQ(same, std::vector<uint64_t>(500, 42));
+}
+
+TEST(mini_algo_test, radix_sort_floating_point)
+{
+    std::vector<double> v;
+    for (int64_t x : random_bits<int64_t>(3000)) {
+        v.push_back(double(x % 1000000) / 7.0);
+    }
+    v.push_back(-0.0);
+    v.push_back(0.0);
+    v.push_back(std::numeric_limits<double>::infinity());
+    v.push_back(-std::numeric_limits<double>::infinity());
+    v.push_back(std::numeric_limits<double>::denorm_min());
+    std::vector<double> expected(v);
+    std::sort(expected.begin(), expected.end());
+
+    std::vector<double> lsd(v);
+    mini::algo::radix_sort(lsd.data(), lsd.data() + lsd.size());
+    EXPECT_EQ(lsd, expected);  // -0.0 == 0.0, whatever their order
+    std::vector<double> msd(v);
+    mini::algo::radix_sort_msd(msd.data(), msd.data() + msd.size());
+    EXPECT_EQ(msd, expected);
+
+    std::vector<float> f;
+    for (int32_t x : random_bits<int32_t>(1000)) {
+        f.push_back(float(x) * 1e-3f);
+    }
+    mini::algo::radix_sort(f.data(), f.data() + f.size());
+    EXPECT_TRUE(std::is_sorted(f.begin(), f.end()));
+}
+
+TEST(mini_algo_test, radix_sort_records)
+{
+    std::vector<record> v;
+    for (int32_t x : random_bits<int32_t>(3000)) {
+        v.push_back(record{x % 50, std::to_string(v.size())});
+    }
+    auto key_of = [](const record& r) { return r.key; };
+
+    std::vector<record> expected(v);
+    std::stable_sort(expected.begin(), expected.end(),
+        [](const record& a, const record& b) { return a.key < b.key; });
+
+    mini::algo::radix_sort(v.data(), v.data() + v.size(), key_of);
+    for (size_t i = 0; i < v.size(); ++i) {
+        ASSERT_EQ(v[i].key, expected[i].key);
+        ASSERT_EQ(v[i].payload, expected[i].payload);
+    }
+
+    std::vector<record> w(expected.rbegin(), expected.rend());
+    mini::algo::radix_sort_msd(w.data(), w.data() + w.size(), key_of);
+    EXPECT_TRUE(std::is_sorted(w.begin(), w.end(),
+        [](const record& a, const record& b) { return a.key < b.key; }));
+}
+
+TEST(mini_algo_test, radix_sort_parallel)
+{
+    mini::exec::thread_pool pool(4);
+    const auto par = mini::exec::par.on(pool);
+
+    std::vector<uint64_t> u = random_bits<uint64_t>(100000);
+    std::vector<uint64_t> expected(u);
+    std::sort(expected.begin(), expected.end());
+    mini::algo::radix_sort(par, u.data(), u.data() + u.size());
+    EXPECT_EQ(u, expected);
+
+    // stability across pieces, non-trivial elements
+    std::vector<record> v;
+    for (int32_t x : random_bits<int32_t>(50000)) {
+        v.push_back(record{x % 1000, std::to_string(v.size())});
+    }
+    std::vector<record> expected_v(v);
+    std::stable_sort(expected_v.begin(), expected_v.end(),
+        [](const record& a, const record& b) { return a.key < b.key; });
+    mini::algo::radix_sort(
+        par, v.data(), v.data() + v.size(), [](const record& r) { return r.key; });
+    for (size_t i = 0; i < v.size(); ++i) {
+        ASSERT_EQ(v[i].payload, expected_v[i].payload);
+    }
+
+    // deque, floating point keys
+    mini::ctnr::deque<float> d;
+    for (int32_t x : random_bits<int32_t>(60000)) {
+        d.push_back(float(x));
+    }
+    mini::algo::radix_sort(par, d.begin(), d.end());
+    EXPECT_TRUE(std::is_sorted(d.begin(), d.end()));
+
+    // sequential policy
+    std::vector<int> small{5, -3, 9, 0};
+    mini::algo::radix_sort(mini::exec::seq, small.data(), small.data() + small.size());
+    EXPECT_EQ(dump(small), "-3 0 5 9");
+}
+
+TEST(mini_algo_test, radix_sort_parallel_exception)
+{
+    mini::exec::thread_pool pool(4);
+    {
+        std::vector<move_limited> v;
+        v.reserve(50000);
+        for (int32_t x : random_bits<int32_t>(50000)) {
+            v.emplace_back(x % 1000);
+        }
+        // fails while the pieces move the elements into the buffer: the pieces already moved
+        // are destroyed again
+        move_limited::moves_left = 30000;
+        EXPECT_THROW(mini::algo::radix_sort(mini::exec::par.on(pool), v.data(),
+                         v.data() + v.size(), [](const move_limited& m) { return m.key; }),
+            std::runtime_error);
+        EXPECT_EQ(move_limited::live.load(), 50000);
+    }
+    EXPECT_EQ(move_limited::live.load(), 0);
+}
@@ -0,0 +1,90 @@
+#include "mini_stl/test/mini_unittest.h"
+
+#include "mini_stl/algorithm/mini_algorithm.h"
+#include "mini_stl/container/mini_container_deque.h"
+#include "mini_stl/container/mini_container_list.h"
+#include "mini_stl/functional/mini_functional.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+TEST(mini_algo_test, lower_upper_bound)
+{
+    for (size_t n : {0, 1, 2, 3, 4, 5, 7, 8, 9, 16, 31, 100, 1000, 4097}) {
+        std::vector<int> v = sorted_values(n, uint32_t(n / 2 + 1));
+        const int* first = v.data();
+        const int* last = v.data() + n;
+        for (int key = -1; key <= int(n / 2) + 1; ++key) {
+            ASSERT_EQ(mini::algo::lower_bound(first, last, key), std::lower_bound(first, last, key))
+                << n << " " << key;
+            ASSERT_EQ(mini::algo::upper_bound(first, last, key), std::upper_bound(first, last, key))
+                << n << " " << key;
+        }
+    }
+
+    // descending order with a comparator
+    std::vector<int> v = sorted_values(500, 100);
+    std::reverse(v.begin(), v.end());
+    const int* first = v.data();
+    const int* last = v.data() + v.size();
+    for (int key = -1; key <= 100; ++key) {
+        EXPECT_EQ(mini::algo::lower_bound(first, last, key, mini::func::greater<int>()),
+            std::lower_bound(first, last, key, std::greater<int>()));
+        EXPECT_EQ(mini::algo::upper_bound(first, last, key, mini::func::greater<int>()),
+            std::upper_bound(first, last, key, std::greater<int>()));
+    }
+
+    // heterogeneous comparison against a key of another type
+    std::vector<std::string> words = {"apple", "banana", "banana", "cherry", "date"};
+    EXPECT_EQ(mini::algo::lower_bound(words.data(), words.data() + 5, "banana") - words.data(), 1);
+    EXPECT_EQ(mini::algo::upper_bound(words.data(), words.data() + 5, "banana") - words.data(), 3);
+    EXPECT_EQ(mini::algo::lower_bound(words.data(), words.data() + 5, "zebra") - words.data(), 5);
+}
+
+TEST(mini_algo_test, lower_upper_bound_iterators)
+{
+    std::vector<int> v = sorted_values(3000, 700);
+    mini::ctnr::deque<int> d;
+    mini::ctnr::list<int> l;
+    for (int x : v) {
+        d.push_back(x);
+        l.push_back(x);
+    }
+    for (int key = -1; key <= 701; key += 3) {
+        const ptrdiff_t lower = std::lower_bound(v.begin(), v.end(), key) - v.begin();
+        const ptrdiff_t upper = std::upper_bound(v.begin(), v.end(), key) - v.begin();
+
+        // random access, not contiguous
+        ASSERT_EQ(mini::algo::lower_bound(d.begin(), d.end(), key) - d.begin(), lower);
+        ASSERT_EQ(mini::algo::upper_bound(d.begin(), d.end(), key) - d.begin(), upper);
+
+        // bidirectional
+        ASSERT_EQ(mini::iter::distance(l.begin(), mini::algo::lower_bound(l.begin(), l.end(), key)),
+            lower);
+        ASSERT_EQ(mini::iter::distance(l.begin(), mini::algo::upper_bound(l.begin(), l.end(), key)),
+            upper);
+    }
+}
+
+TEST(mini_algo_test, equal_range_binary_search)
+{
+    mini::ctnr::deque<int> d;
+    for (int x : {1, 3, 3, 3, 5, 8, 8, 13}) {
+        d.push_back(x);
+    }
+    auto range = mini::algo::equal_range(d.begin(), d.end(), 3);
+    EXPECT_EQ(range.first - d.begin(), 1);
+    EXPECT_EQ(range.second - d.begin(), 4);
+    range = mini::algo::equal_range(d.begin(), d.end(), 4);
+    EXPECT_EQ(range.first, range.second);
+    EXPECT_EQ(range.first - d.begin(), 4);
+
+    EXPECT_TRUE(mini::algo::binary_search(d.begin(), d.end(), 1));
+    EXPECT_TRUE(mini::algo::binary_search(d.begin(), d.end(), 13));
+    EXPECT_FALSE(mini::algo::binary_search(d.begin(), d.end(), 0));
+    EXPECT_FALSE(mini::algo::binary_search(d.begin(), d.end(), 7));
+    EXPECT_FALSE(mini::algo::binary_search(d.begin(), d.end(), 14));
+    EXPECT_FALSE(mini::algo::binary_search(d.begin(), d.begin(), 1));
+}
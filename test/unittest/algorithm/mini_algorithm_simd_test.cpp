@@ -0,0 +1,226 @@
+#include "mini_stl/test/mini_unittest.h"
+
+#include "mini_stl/algorithm/mini_algorithm.h"
+#include "mini_stl/container/mini_container_deque.h"
+#include "mini_stl/container/mini_container_vector.h"
+
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+namespace {
+
+// Every instruction set the running CPU has
+std::vector<mini::algo::__simd_level> levels()
+{
+    std::vector<mini::algo::__simd_level> result;
+    for (int level = mini::algo::__simd_scalar; level <= mini::algo::__simd_cpu_level(); ++level) {
+        result.push_back(mini::algo::__simd_level(level));
+    }
+    return result;
+}
+
+// Compare every kernel at every level with a plain loop, for lengths around the vector widths
+template<typename T>
+void check_kernels()
+{
+    for (mini::algo::__simd_level level : levels()) {
+        for (size_t n : {0, 1, 7, 15, 16, 31, 33, 63, 64, 65, 127, 200, 1000}) {
+            std::vector<T> v = random_values<T>(n, 100, uint32_t(n + 1));
+            const T* p = v.data();
+
+            for (T key : {T(0), T(42), T(99), T(100)}) {
+                size_t expected_find = 0;
+                while (expected_find < n && !(p[expected_find] == key)) {
+                    ++expected_find;
+                }
+                size_t expected_count = 0;
+                for (size_t i = 0; i < n; ++i) {
+                    expected_count += p[i] == key;
+                }
+                ASSERT_EQ(mini::algo::__simd_find(p, n, key, level), expected_find) << level;
+                ASSERT_EQ(mini::algo::__simd_count(p, n, key, level), expected_count) << level;
+            }
+
+            std::vector<T> w(v);
+            ASSERT_EQ(mini::algo::__simd_mismatch(p, w.data(), n, level), n) << level;
+            for (size_t i : {size_t(0), n / 3, n - 1}) {
+                if (i < n) {
+                    std::vector<T> u(v);
+                    u[i] = T(u[i] + 1);
+                    ASSERT_EQ(mini::algo::__simd_mismatch(p, u.data(), n, level), i) << level;
+                }
+            }
+
+            if (n != 0) {
+                T min_value = p[0], max_value = p[0];
+                for (size_t i = 1; i < n; ++i) {
+                    min_value = p[i] < min_value ? p[i] : min_value;
+                    max_value = max_value < p[i] ? p[i] : max_value;
+                }
+                T value;
+                if (mini::algo::__simd_extremum<false>(p, n, value, level)) {
+                    ASSERT_EQ(value, min_value) << level;
+                }
+                if (mini::algo::__simd_extremum<true>(p, n, value, level)) {
+                    ASSERT_EQ(value, max_value) << level;
+                }
+            }
+        }
+    }
+}
+
+// Extreme values of T, where signed and unsigned lanes differ
+template<typename T>
+void check_extremes()
+{
+    std::vector<T> v(100, T(5));
+    v[37] = std::numeric_limits<T>::max();
+    v[81] = std::numeric_limits<T>::lowest();
+    for (mini::algo::__simd_level level : levels()) {
+        T value;
+        if (mini::algo::__simd_extremum<false>(v.data(), v.size(), value, level)) {
+            EXPECT_EQ(value, std::numeric_limits<T>::lowest()) << level;
+        }
+        if (mini::algo::__simd_extremum<true>(v.data(), v.size(), value, level)) {
+            EXPECT_EQ(value, std::numeric_limits<T>::max()) << level;
+        }
+    }
+    EXPECT_EQ(mini::algo::min_element(v.data(), v.data() + v.size()) - v.data(), 81);
+    EXPECT_EQ(mini::algo::max_element(v.data(), v.data() + v.size()) - v.data(), 37);
+}
+
+}  // namespace
+
+TEST(mini_algo_test, simd_kernels)
+{
+    check_kernels<int8_t>();
+    check_kernels<uint8_t>();
+    check_kernels<int16_t>();
+    check_kernels<uint16_t>();
+    check_kernels<int32_t>();
+    check_kernels<uint32_t>();
+    check_kernels<int64_t>();
+    check_kernels<uint64_t>();
+    check_kernels<float>();
+    check_kernels<double>();
+
+    check_extremes<int8_t>();
+    check_extremes<uint8_t>();
+    check_extremes<int16_t>();
+    check_extremes<uint16_t>();
+    check_extremes<int32_t>();
+    check_extremes<uint32_t>();
+    check_extremes<int64_t>();
+    check_extremes<uint64_t>();
+    check_extremes<float>();
+    check_extremes<double>();
+}
+
+TEST(mini_algo_test, simd_find_count)
+{
+    mini::ctnr::vector<int32_t> v;
+    for (int32_t x : random_values<int32_t>(1000, 500)) {
+        v.push_back(x);
+    }
+    v[700] = 1000;
+    EXPECT_EQ(mini::algo::find(v.begin(), v.end(), 1000) - v.begin(), 700);
+    EXPECT_EQ(mini::algo::find(v.begin(), v.end(), 1001), v.end());
+    EXPECT_EQ(mini::algo::count(v.begin(), v.end(), 1000), 1);
+
+    // the value converts to the element type only if it compares the same way
+    mini::ctnr::vector<uint8_t> bytes(100, uint8_t(255));
+    EXPECT_EQ(mini::algo::count(bytes.begin(), bytes.end(), 255), 100);
+    EXPECT_EQ(mini::algo::count(bytes.begin(), bytes.end(), -1), 0);
+    EXPECT_EQ(mini::algo::find(bytes.begin(), bytes.end(), 511), bytes.end());
+    mini::ctnr::vector<int64_t> wide(100, int64_t(-1));
+    EXPECT_EQ(mini::algo::count(wide.begin(), wide.end(), -1), 100);
+    EXPECT_EQ(mini::algo::count(wide.begin(), wide.end(), 0xFFFFFFFFu), 0);
+
+    // floating point: NaN equals nothing, -0.0 equals +0.0
+    mini::ctnr::vector<float> f(100, 1.5f);
+    f[10] = std::nanf("");
+    f[60] = -0.0f;
+    EXPECT_EQ(mini::algo::find(f.begin(), f.end(), f[10]), f.end());
+    EXPECT_EQ(mini::algo::find(f.begin(), f.end(), 0.0f) - f.begin(), 60);
+    EXPECT_EQ(mini::algo::count(f.begin(), f.end(), 1.5f), 98);
+
+    // deque buffers go through the pointer kernels
+    mini::ctnr::deque<int16_t> d;
+    for (int i = 0; i < 5000; ++i) {
+        d.push_back(int16_t(i % 100));
+    }
+    EXPECT_EQ(mini::algo::count(d.begin(), d.end(), int16_t(7)), 50);
+    EXPECT_EQ(mini::algo::find(d.begin() + 8, d.end(), int16_t(7)) - d.begin(), 107);
+}
+
+TEST(mini_algo_test, simd_min_max_element)
+{
+    mini::ctnr::vector<int32_t> v;
+    for (int32_t x : random_values<int32_t>(1000, 1000)) {
+        v.push_back(x + 10);
+    }
+    v[123] = 3;
+    v[456] = 3;
+    v[789] = 2000;
+    v[790] = 2000;
+    // the first of equal extremes
+    EXPECT_EQ(mini::algo::min_element(v.begin(), v.end()) - v.begin(), 123);
+    EXPECT_EQ(mini::algo::max_element(v.begin(), v.end()) - v.begin(), 789);
+    EXPECT_EQ(mini::algo::min_element(v.begin(), v.end(), mini::func::greater<int32_t>())
+                  - v.begin(),
+        789);
+    EXPECT_EQ(mini::algo::min_element(v.begin(), v.begin()), v.begin());
+
+    mini::ctnr::vector<double> f(300, 0.5);
+    f[40] = -0.0;
+    f[41] = 0.0;
+    f[42] = -2.5;
+    f[250] = 7.0;
+    EXPECT_EQ(mini::algo::min_element(f.begin(), f.end()) - f.begin(), 42);
+    EXPECT_EQ(mini::algo::max_element(f.begin(), f.end()) - f.begin(), 250);
+    f[42] = 0.5;
+    EXPECT_EQ(mini::algo::min_element(f.begin(), f.end()) - f.begin(), 40);
+
+    // with a NaN, the answer is the one of the sequential definition
+    f[0] = std::nan("");
+    EXPECT_EQ(mini::algo::min_element(f.begin(), f.end()) - f.begin(), 0);
+    EXPECT_EQ(mini::algo::max_element(f.begin(), f.end()) - f.begin(), 0);
+    f[0] = 0.5;
+    f[100] = std::nan("");
+    EXPECT_EQ(mini::algo::min_element(f.begin(), f.end()) - f.begin(), 40);
+    EXPECT_EQ(mini::algo::max_element(f.begin(), f.end()) - f.begin(), 250);
+}
+
+TEST(mini_algo_test, simd_equal_mismatch)
+{
+    mini::ctnr::vector<float> a(500, 1.0f), b(500, 1.0f);
+    EXPECT_TRUE(mini::algo::equal(a.begin(), a.end(), b.begin()));
+    auto same = mini::algo::mismatch(a.begin(), a.end(), b.begin());
+    EXPECT_EQ(same.first, a.end());
+    EXPECT_EQ(same.second, b.end());
+
+    // -0.0 == +0.0 although the bytes differ; NaN != NaN although they may not
+    a[100] = 0.0f;
+    b[100] = -0.0f;
+    EXPECT_TRUE(mini::algo::equal(a.begin(), a.end(), b.begin()));
+    a[300] = b[300] = std::nanf("");
+    EXPECT_FALSE(mini::algo::equal(a.begin(), a.end(), b.begin()));
+    auto diff = mini::algo::mismatch(a.begin(), a.end(), b.begin());
+    EXPECT_EQ(diff.first - a.begin(), 300);
+    EXPECT_EQ(diff.second - b.begin(), 300);
+
+    mini::ctnr::vector<int64_t> x(77, 9), y(77, 9);
+    y[76] = 8;
+    EXPECT_EQ(mini::algo::mismatch(x.begin(), x.end(), y.begin()).first - x.begin(), 76);
+    EXPECT_EQ(mini::algo::mismatch(x.begin(), x.end(), y.begin(),
+                  [](int64_t p, int64_t q) { return p >= q; })
+                  .first,
+        x.end());
+
+    // different element types take the scalar loop
+    mini::ctnr::vector<int32_t> z(77, 9);
+    EXPECT_EQ(mini::algo::mismatch(z.begin(), z.end(), y.begin()).first - z.begin(), 76);
+    EXPECT_FALSE(mini::algo::equal(z.begin(), z.end(), y.begin()));
+}
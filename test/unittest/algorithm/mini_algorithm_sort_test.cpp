@@ -0,0 +1,180 @@
+#include "mini_stl/test/mini_unittest.h"
+
+#include "mini_stl/algorithm/mini_algorithm.h"
+#include "mini_stl/container/mini_container_deque.h"
+#include "mini_stl/container/mini_container_vector.h"
+#include "mini_stl/functional/mini_functional.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace {
+
+// Inputs known to hurt naive quicksorts
+std::vector<std::vector<int>> sort_inputs()
+{
+    std::vector<std::vector<int>> inputs;
+    inputs.push_back({});
+    inputs.push_back({1});
+    inputs.push_back({2, 1});
+    inputs.push_back(random_values(1000, 1000000));
+    inputs.push_back(random_values(1000, 3));  // many duplicates
+    std::vector<int> sorted(1000);
+    for (int i = 0; i < 1000; ++i) {
+        sorted[i] = i;
+    }
+    inputs.push_back(sorted);
+    inputs.push_back(std::vector<int>(sorted.rbegin(), sorted.rend()));
+    std::vector<int> organ_pipe(sorted);
+    std::reverse(organ_pipe.begin() + 500, organ_pipe.end());
+    inputs.push_back(organ_pipe);
+    inputs.push_back(std::vector<int>(1000, 7));
+    return inputs;
+}
+
+// mini::iter::iterator_traits does not know std::vector iterators: sort through pointers
+template<typename T>
+T* first_of(std::vector<T>& v)
+{
+    return v.data();
+}
+
+template<typename T>
+T* last_of(std::vector<T>& v)
+{
+    return v.data() + v.size();
+}
+
+struct keyed {
+    int key;
+    int order;  // position before sorting
+
+    bool operator<(const keyed& other) const { return key < other.key; }
+};
+
+}  // namespace
+
+TEST(mini_algo_test, sort)
+{
+    for (const std::vector<int>& input : sort_inputs()) {
+        std::vector<int> expected(input);
+        std::sort(expected.begin(), expected.end());
+
+        std::vector<int> v(input);
+        mini::algo::sort(first_of(v), last_of(v));
+        EXPECT_EQ(v, expected);
+
+        mini::algo::sort(first_of(v), last_of(v), mini::func::greater<int>());
+        EXPECT_EQ(v, std::vector<int>(expected.rbegin(), expected.rend()));
+    }
+
+    // deque iterators, across buffers
+    mini::ctnr::deque<int> d;
+    for (int x : random_values(5000, 100000)) {
+        d.push_back(x);
+    }
+    mini::algo::sort(d.begin(), d.end());
+    EXPECT_TRUE(std::is_sorted(d.begin(), d.end()));
+
+    // non-trivial value type
+    std::vector<std::string> s{"pear", "apple", "fig", "banana", "cherry"};
+    mini::algo::sort(first_of(s), last_of(s));
+    EXPECT_EQ(dump(s), "apple banana cherry fig pear");
+}
+
+TEST(mini_algo_test, stable_sort)
+{
+    std::vector<int> keys = random_values(3000, 50);
+    std::vector<keyed> v(keys.size());
+    for (size_t i = 0; i < keys.size(); ++i) {
+        v[i] = keyed{keys[i], int(i)};
+    }
+    std::vector<keyed> expected(v);
+    std::stable_sort(expected.begin(), expected.end());
+
+    auto same = [](const std::vector<keyed>& a, const std::vector<keyed>& b) {
+        for (size_t i = 0; i < a.size(); ++i) {
+            if (a[i].key != b[i].key || a[i].order != b[i].order) {
+                return false;
+            }
+        }
+        return a.size() == b.size();
+    };
+
+    std::vector<keyed> buffered(v);
+    mini::algo::stable_sort(first_of(buffered), last_of(buffered));
+    EXPECT_TRUE(same(buffered, expected));
+
+    // the fallback used when no buffer can be allocated
+    std::vector<keyed> in_place(v);
+    mini::algo::__inplace_stable_sort(
+        first_of(in_place), last_of(in_place), mini::func::less<>());
+    EXPECT_TRUE(same(in_place, expected));
+
+    for (const std::vector<int>& input : sort_inputs()) {
+        std::vector<int> w(input);
+        mini::algo::stable_sort(first_of(w), last_of(w), mini::func::greater<int>());
+        EXPECT_TRUE(std::is_sorted(w.begin(), w.end(), mini::func::greater<int>()));
+    }
+
+    mini::ctnr::deque<int> d;
+    for (int x : random_values(2000, 1000)) {
+        d.push_back(x);
+    }
+    mini::algo::stable_sort(d.begin(), d.end());
+    EXPECT_TRUE(std::is_sorted(d.begin(), d.end()));
+}
+
+TEST(mini_algo_test, partial_sort)
+{
+    std::vector<int> v = random_values(1000, 10000);
+    std::vector<int> expected(v);
+    std::sort(expected.begin(), expected.end());
+
+    mini::algo::partial_sort(first_of(v), first_of(v) + 10, last_of(v));
+    EXPECT_TRUE(std::equal(v.begin(), v.begin() + 10, expected.begin()));
+
+    // the rest is a permutation of the other elements
+    std::sort(v.begin() + 10, v.end());
+    EXPECT_EQ(v, expected);
+
+    int arr[] = {3, 1, 2};
+    mini::algo::partial_sort(arr, arr, arr + 3);
+    EXPECT_EQ(dump(arr), "3 1 2");
+    mini::algo::partial_sort(arr, arr + 3, arr + 3, mini::func::greater<int>());
+    EXPECT_EQ(dump(arr), "3 2 1");
+}
+
+TEST(mini_algo_test, nth_element)
+{
+    for (const std::vector<int>& input : sort_inputs()) {
+        if (input.empty()) {
+            continue;
+        }
+        std::vector<int> expected(input);
+        std::sort(expected.begin(), expected.end());
+        for (size_t nth : {size_t(0), input.size() / 3, input.size() - 1}) {
+            std::vector<int> v(input);
+            mini::algo::nth_element(first_of(v), first_of(v) + nth, last_of(v));
+            EXPECT_EQ(v[nth], expected[nth]);
+            for (size_t i = 0; i < nth; ++i) {
+                ASSERT_LE(v[i], v[nth]);
+            }
+            for (size_t i = nth + 1; i < v.size(); ++i) {
+                ASSERT_GE(v[i], v[nth]);
+            }
+        }
+    }
+
+    // depth limit reached: heap selection
+    std::vector<int> v = random_values(500, 1000);
+    std::vector<int> expected(v);
+    std::sort(expected.begin(), expected.end());
+    mini::algo::__introselect(
+        first_of(v), first_of(v) + 123, last_of(v), 0, mini::func::less<>());
+    EXPECT_EQ(v[123], expected[123]);
+    EXPECT_TRUE(*std::max_element(v.begin(), v.begin() + 123) <= v[123]);
+    EXPECT_TRUE(*std::min_element(v.begin() + 124, v.end()) >= v[123]);
+}
@@ -0,0 +1,70 @@
+#include "mini_stl/test/mini_unittest.h"
+
+#include "mini_stl/algorithm/mini_algorithm_base.h"
+#include "mini_stl/base/mini_base_type_traits.h"
+#include "mini_stl/memory/mini_memory.h"
+
+#include <string>
+#include <type_traits>
+
+namespace {
+
+using mini::type_traits::__false_type;
+using mini::type_traits::__true_type;
+using mini::type_traits::__type_traits;
+
+struct quote {
+    int id;
+    double bid;
+    double ask;
+};
+
+struct named_quote {
+    std::string name;
+    double price;
+};
+
+}  // namespace
+
+TEST(mini_base_test, type_traits_test_deduced)
+{
+    // scalar types and pointers
+    EXPECT_TRUE((std::is_same_v<__type_traits<int>::is_POD_type, __true_type>));
+    EXPECT_TRUE((std::is_same_v<__type_traits<double>::is_POD_type, __true_type>));
+    EXPECT_TRUE((std::is_same_v<__type_traits<int*>::has_trivial_assignment_operator, __true_type>));
+
+    // user-defined POD struct
+    EXPECT_TRUE((std::is_same_v<__type_traits<quote>::is_POD_type, __true_type>));
+    EXPECT_TRUE(
+        (std::is_same_v<__type_traits<quote>::has_trivial_assignment_operator, __true_type>));
+    EXPECT_TRUE((std::is_same_v<__type_traits<quote>::has_trivial_destructor, __true_type>));
+
+    // non-trivial struct
+    EXPECT_TRUE((std::is_same_v<__type_traits<named_quote>::is_POD_type, __false_type>));
+    EXPECT_TRUE((std::is_same_v<__type_traits<named_quote>::has_trivial_assignment_operator,
+        __false_type>));
+    EXPECT_TRUE((std::is_same_v<__type_traits<named_quote>::has_trivial_destructor, __false_type>));
+}
+
+TEST(mini_base_test, type_traits_test_copy_paths)
+{
+    {
+        quote src[3] = {{1, 1.5, 2.5}, {2, 3.5, 4.5}, {3, 5.5, 6.5}};
+        quote dst[3] = {};
+        EXPECT_EQ(mini::algo::copy(src, src + 3, dst), dst + 3);
+        EXPECT_EQ(dst[2].id, 3);
+        EXPECT_EQ(dst[1].ask, 4.5);
+
+        quote raw[3];
+        EXPECT_EQ(mini::mem::uninitialized_copy(src, src + 3, raw), raw + 3);
+        EXPECT_EQ(raw[0].bid, 1.5);
+    }
+
+    {
+        named_quote src[2] = {{"a", 1.0}, {"b", 2.0}};
+        named_quote dst[2];
+        mini::algo::copy(src, src + 2, dst);
+        EXPECT_EQ(dst[1].name, "b");
+        EXPECT_EQ(dst[1].price, 2.0);
+    }
+}
@@ -0,0 +1,215 @@
+#include "mini_stl/test/mini_unittest.h"
+
+#include "mini_stl/container/adapter/mini_container_adapter_indexed_priority_queue.h"
+
+#include <cstdint>
+#include <cstdlib>
+#include <functional>
+#include <limits>
+#include <map>
+#include <queue>
+#include <set>
+#include <string>
+#include <utility>
+#include <vector>
+
+TEST(mini_container_test, adapter_indexed_priority_queue_test_basic)
+{
+    using queue = mini::ctnr::indexed_priority_queue<int>;
+
+    queue q;
+    EXPECT_TRUE(q.empty());
+    const queue::handle_type a = q.push(5);
+    const queue::handle_type b = q.push(3);
+    const queue::handle_type c = q.push(8);
+    EXPECT_EQ(q.size(), 3u);
+    EXPECT_EQ(q.top(), 3);
+    EXPECT_EQ(q.top_handle(), b);
+
+    q.decrease_key(c, 1);
+    EXPECT_EQ(q.top(), 1);
+    EXPECT_EQ(q.top_handle(), c);
+    EXPECT_EQ(q[c], 1);
+
+    q.increase_key(c, 9);
+    EXPECT_EQ(q.top_handle(), b);
+    q.update(a, 2);
+    EXPECT_EQ(q.top_handle(), a);
+
+    q.erase(b);
+    EXPECT_FALSE(q.contains(b));
+    EXPECT_TRUE(q.contains(a));
+    EXPECT_EQ(q.size(), 2u);
+
+    q.pop();
+    EXPECT_EQ(q.top(), 9);
+    EXPECT_FALSE(q.contains(a));
+
+    // freed handles are given out again
+    const queue::handle_type d = q.push(4);
+    EXPECT_TRUE(d == a || d == b);
+    EXPECT_EQ(q.top_handle(), d);
+
+    queue copy(q);
+    q.clear();
+    EXPECT_TRUE(q.empty());
+    EXPECT_FALSE(q.contains(c));
+    EXPECT_EQ(copy.size(), 2u);
+    EXPECT_EQ(copy.top(), 4);
+    copy.pop();
+    EXPECT_EQ(copy.top_handle(), c);
+}
+
+TEST(mini_container_test, adapter_indexed_priority_queue_test_random)
+{
+    using queue = mini::ctnr::indexed_priority_queue<int, std::greater<int>, 3>;
+
+    std::srand(47);
+    queue q;
+    std::map<queue::handle_type, int> live;
+    std::multiset<int, std::greater<int>> order;
+    for (int step = 0; step < 20000; ++step) {
+        const int op = std::rand() % 6;
+        const int value = std::rand() % 1000;
+        if (op <= 1 || live.empty()) {
+            const queue::handle_type h = q.push(value);
+            ASSERT_EQ(live.count(h), 0u);
+            live[h] = value;
+            order.insert(value);
+        } else if (op == 2) {
+            const queue::handle_type h = q.top_handle();
+            ASSERT_EQ(q.top(), *order.begin());
+            q.pop();
+            EXPECT_FALSE(q.contains(h));
+            order.erase(order.begin());
+            live.erase(h);
+        } else {
+            auto it = live.begin();
+            std::advance(it, std::rand() % live.size());
+            const queue::handle_type h = it->first;
+            ASSERT_TRUE(q.contains(h));
+            ASSERT_EQ(q[h], it->second);
+            order.erase(order.find(it->second));
+            if (op == 3) {
+                q.erase(h);
+                live.erase(it);
+                continue;
+            }
+            int v = value;
+            if (op == 4) {
+                // greater order: a larger value moves toward the top
+                v = it->second + std::rand() % 100;
+                q.decrease_key(h, v);
+            } else {
+                q.update(h, v);
+            }
+            it->second = v;
+            order.insert(v);
+        }
+        ASSERT_EQ(q.size(), order.size());
+        if (!q.empty()) {
+            ASSERT_EQ(q.top(), *order.begin());
+        }
+    }
+    while (!q.empty()) {
+        ASSERT_EQ(q.top(), *order.begin());
+        order.erase(order.begin());
+        q.pop();
+    }
+}
+
+TEST(mini_container_test, adapter_indexed_priority_queue_test_dijkstra)
+{
+    typedef std::pair<uint64_t, uint32_t> entry;  // distance, vertex
+    const uint32_t n = 2000;
+    const uint64_t inf = std::numeric_limits<uint64_t>::max();
+
+    std::srand(4747);
+    std::vector<std::vector<std::pair<uint32_t, uint32_t>>> adj(n);
+    for (uint32_t u = 0; u < n; ++u) {
+        for (int e = 0; e < 6; ++e) {
+            adj[u].emplace_back(uint32_t(std::rand()) % n, uint32_t(std::rand()) % 1000);
+        }
+    }
+
+    // reference: lazy deletion, duplicates in the queue
+    std::vector<uint64_t> expected(n, inf);
+    {
+        std::priority_queue<entry, std::vector<entry>, std::greater<entry>> q;
+        expected[0] = 0;
+        q.push(entry(0, 0));
+        while (!q.empty()) {
+            const entry top = q.top();
+            q.pop();
+            if (top.first != expected[top.second]) {
+                continue;
+            }
+            for (const auto& [v, w] : adj[top.second]) {
+                if (top.first + w < expected[v]) {
+                    expected[v] = top.first + w;
+                    q.push(entry(expected[v], v));
+                }
+            }
+        }
+    }
+
+    // one queue entry per vertex, re-ranked by decrease_key
+    typedef mini::ctnr::indexed_priority_queue<entry> queue;
+    std::vector<uint64_t> dist(n, inf);
+    std::vector<queue::handle_type> handle(n);
+    std::vector<bool> queued(n, false);
+    queue q;
+    size_t peak = 0;
+    dist[0] = 0;
+    handle[0] = q.push(entry(0, 0));
+    queued[0] = true;
+    while (!q.empty()) {
+        peak = q.size() > peak ? q.size() : peak;
+        const uint32_t u = q.top().second;
+        q.pop();
+        queued[u] = false;
+        for (const auto& [v, w] : adj[u]) {
+            if (dist[u] + w < dist[v]) {
+                dist[v] = dist[u] + w;
+                if (queued[v]) {
+                    q.decrease_key(handle[v], entry(dist[v], v));
+                } else {
+                    handle[v] = q.push(entry(dist[v], v));
+                    queued[v] = true;
+                }
+            }
+        }
+    }
+    EXPECT_EQ(dist, expected);
+    EXPECT_LE(peak, n);
+}
+
+TEST(mini_container_test, adapter_indexed_priority_queue_test_string)
+{
+    using queue = mini::ctnr::indexed_priority_queue<std::string>;
+
+    queue q;
+    std::vector<queue::handle_type> handles;
+    for (int i = 0; i < 200; ++i) {
+        handles.push_back(q.push(std::string(40, char('a' + i % 26)) + std::to_string(i)));
+    }
+    q.reserve(1000);
+    for (int i = 0; i < 200; i += 3) {
+        q.erase(handles[i]);
+    }
+    q.update(handles[100], std::string("!"));
+    EXPECT_EQ(q.top(), "!");
+    queue moved(std::move(q));
+    EXPECT_TRUE(q.empty());
+    q = moved;
+    std::string last;
+    while (!moved.empty()) {
+        EXPECT_LE(last, moved.top());
+        last = moved.top();
+        moved.pop();
+    }
+    EXPECT_EQ(q.size(), 200u - 67u);
+    // the last freed handle is given out first
+    EXPECT_EQ(q.emplace(3, 'z'), handles[198]);
+    EXPECT_EQ(q[handles[198]], "zzz");
+}
@@ -0,0 +1,173 @@
+#include "mini_stl/test/mini_unittest.h"
+
+#include "mini_stl/container/adapter/mini_container_adapter_mpmc_queue.h"
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+TEST(mini_container_test, adapter_mpmc_queue_test_basics)
+{
+    using mpmc_queue = mini::ctnr::mpmc_queue<int>;
+
+    mpmc_queue q(3);
+    EXPECT_EQ(q.capacity(), 4);
+    EXPECT_TRUE(q.empty());
+
+    int value = 0;
+    EXPECT_FALSE(q.try_pop(value));
+    for (int i = 0; i < 4; ++i) {
+        EXPECT_TRUE(q.try_push(i));
+    }
+    EXPECT_FALSE(q.try_push(4));  // full
+    EXPECT_EQ(q.size(), 4);
+
+    EXPECT_TRUE(q.try_pop(value));
+    EXPECT_EQ(value, 0);
+
+    // batches are cut at what is available
+    const int in[] = {10, 11, 12};
+    EXPECT_EQ(q.try_push_n(in, 3), 1);
+    int out[8] = {};
+    EXPECT_EQ(q.try_pop_n(out, 8), 4);
+    EXPECT_EQ(dump(std::vector<int>(out, out + 4)), "1 2 3 10");
+    EXPECT_EQ(q.try_pop_n(out, 8), 0);
+    EXPECT_EQ(q.try_push_n(in, 3), 3);
+    EXPECT_EQ(q.try_pop_n(out, 2), 2);
+    EXPECT_EQ(out[1], 11);
+
+    // blocking operations return at once when they can proceed
+    q.push(20);
+    q.pop(value);
+    EXPECT_EQ(value, 12);
+    q.pop(value);
+    EXPECT_EQ(value, 20);
+}
+
+TEST(mini_container_test, adapter_mpmc_queue_test_nonprimitive_types)
+{
+    using mpmc_queue = mini::ctnr::mpmc_queue<std::unique_ptr<std::string>>;
+
+    mpmc_queue q(4);
+    EXPECT_TRUE(q.try_push(std::make_unique<std::string>("a")));
+    EXPECT_TRUE(q.try_emplace(new std::string("b")));
+
+    std::unique_ptr<std::string> p = std::make_unique<std::string>("c");
+    EXPECT_TRUE(q.try_push(std::move(p)));
+    EXPECT_EQ(p, nullptr);
+
+    std::unique_ptr<std::string> value;
+    EXPECT_TRUE(q.try_pop(value));
+    EXPECT_EQ(*value, "a");
+
+    // copying elements: std::string copies may throw, batch push falls back to single pushes
+    mini::ctnr::mpmc_queue<std::string> strings(4);
+    const std::string in[] = {"x", "yy", "zzz"};
+    EXPECT_EQ(strings.try_push_n(in, 3), 3);
+    std::string out[3];
+    EXPECT_EQ(strings.try_pop_n(out, 3), 3);
+    EXPECT_EQ(out[2], "zzz");
+
+    // remaining elements are destroyed with the queue
+}
+
+TEST(mini_container_test, adapter_mpmc_queue_test_threads)
+{
+    using mpmc_queue = mini::ctnr::mpmc_queue<std::uint64_t>;
+
+    const int producers = 4;
+    const int consumers = 4;
+    const std::uint64_t per_producer = 50000;
+    mpmc_queue q(128);
+
+    std::vector<std::thread> threads;
+    for (int p = 0; p < producers; ++p) {
+        threads.emplace_back([&q, p, per_producer] {
+            std::uint64_t batch[4];
+            for (std::uint64_t i = 0; i < per_producer;) {
+                std::uint64_t value = std::uint64_t(p) * per_producer + i;
+                if (i % 2 == 0) {
+                    q.push(value);  // blocking
+                    ++i;
+                } else {
+                    std::uint64_t n = per_producer - i < 4 ? per_producer - i : 4;
+                    for (std::uint64_t j = 0; j < n; ++j) {
+                        batch[j] = value + j;
+                    }
+                    std::uint64_t pushed = q.try_push_n(batch, n);
+                    if (pushed == 0) {
+                        std::this_thread::yield();  // full: let the consumers run
+                    }
+                    i += pushed;
+                }
+            }
+        });
+    }
+
+    // each consumer sums what it pops, every value must be seen exactly once
+    std::atomic<std::uint64_t> sum(0);
+    std::atomic<std::uint64_t> popped(0);
+    const std::uint64_t total = producers * per_producer;
+    for (int c = 0; c < consumers; ++c) {
+        threads.emplace_back([&, c] {
+            std::uint64_t local_sum = 0;
+            std::uint64_t batch[3];
+            while (popped.load() < total) {
+                std::uint64_t value;
+                if (c % 2 == 0) {
+                    size_t n = q.try_pop_n(batch, 3);
+                    for (size_t i = 0; i < n; ++i) {
+                        local_sum += batch[i];
+                    }
+                    popped += n;
+                    if (n == 0) {
+                        std::this_thread::yield();  // empty: let the producers run
+                    }
+                } else if (q.try_pop(value)) {
+                    local_sum += value;
+                    ++popped;
+                } else {
+                    std::this_thread::yield();
+                }
+            }
+            sum += local_sum;
+        });
+    }
+    for (std::thread& t : threads) {
+        t.join();
+    }
+
+    EXPECT_EQ(popped.load(), total);
+    EXPECT_EQ(sum.load(), total * (total - 1) / 2);
+    EXPECT_TRUE(q.empty());
+}
+
+TEST(mini_container_test, adapter_mpmc_queue_test_blocking)
+{
+    using mpmc_queue = mini::ctnr::mpmc_queue<int>;
+
+    // a tiny queue forces both sides to sleep
+    mpmc_queue q(2);
+    const int count = 20000;
+
+    std::thread producer([&q, count] {
+        for (int i = 0; i < count; ++i) {
+            q.push(i);
+        }
+    });
+    std::thread consumer([&q, count] {
+        long long sum = 0;
+        for (int i = 0; i < count; ++i) {
+            int value;
+            q.pop(value);
+            sum += value;
+        }
+        EXPECT_EQ(sum, (long long)count * (count - 1) / 2);
+    });
+    producer.join();
+    consumer.join();
+    EXPECT_TRUE(q.empty());
+}
@@ -2,6 +2,14 @@
 
 #include "mini_stl/container/adapter/mini_container_adapter_priority_queue.h"
 
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <functional>
+#include <list>
+#include <string>
+#include <vector>
+
 TEST(mini_container_test, adapter_priority_queue_test_std_vector)
 {
     using value_type = int;
@@ -45,3 +53,155 @@ TEST(mini_container_test, adapter_priority_queue_test_array)
         EXPECT_EQ(q.top(), 10);
     }
 }
+
+TEST(mini_container_test, adapter_priority_queue_test_compare)
+{
+    // the comparator orders the queue: a min-queue
+    using priority_queue =
+        mini::ctnr::priority_queue<int, mini::ctnr::vector<int>, std::greater<int>>;
+
+    int arr[] = {5, 1, 4, 2, 3};
+    priority_queue q(arr, arr + 5);
+    EXPECT_EQ(q.top(), 1);
+    q.push(0);
+    EXPECT_EQ(q.top(), 0);
+    q.pop();
+    q.pop();
+    EXPECT_EQ(q.top(), 2);
+
+    // stateful comparator
+    struct by_distance {
+        int origin;
+
+        bool operator()(int x, int y) const { return std::abs(x - origin) > std::abs(y - origin); }
+    };
+    mini::ctnr::priority_queue<int, mini::ctnr::vector<int>, by_distance> near(by_distance{10});
+    for (int x : {0, 20, 13, 6, 9}) {
+        near.push(x);
+    }
+    EXPECT_EQ(near.top(), 9);
+    near.pop();
+    EXPECT_EQ(near.top(), 13);
+}
+
+TEST(mini_container_test, adapter_priority_queue_test_dary)
+{
+    using priority_queue = mini::ctnr::priority_queue<int, mini::ctnr::vector<int>,
+        std::less<int>, mini::ctnr::dary_heap_policy<>>;
+
+    std::vector<int> values = random_values(1000, 300, 7);
+    priority_queue q(values.data(), values.data() + 500);
+    for (size_t i = 500; i < values.size(); ++i) {
+        q.push(values[i]);
+    }
+    std::sort(values.begin(), values.end(), std::greater<int>());
+    for (int x : values) {
+        ASSERT_EQ(q.top(), x);
+        q.pop();
+    }
+    EXPECT_TRUE(q.empty());
+
+    // 8-ary min-queue
+    mini::ctnr::priority_queue<int, mini::ctnr::vector<int>, std::greater<int>,
+        mini::ctnr::dary_heap_policy<8>>
+        min_q;
+    for (int x : {5, 3, 9, 1, 7}) {
+        min_q.push(x);
+    }
+    EXPECT_EQ(min_q.top(), 1);
+    min_q.pop();
+    EXPECT_EQ(min_q.top(), 3);
+    EXPECT_EQ(min_q.size(), 4);
+}
+
+TEST(mini_container_test, adapter_priority_queue_test_push_range)
+{
+    std::vector<int> values = random_values(3000, 1000, 50);
+
+    // small batches sift up, large ones rebuild the heap
+    mini::ctnr::priority_queue<int> q;
+    q.push_range(values.begin(), values.begin() + 500);
+    q.push_range(values.begin() + 500, values.begin() + 510);
+    const std::list<int> batch(values.begin() + 510, values.end());
+    q.push_range(batch.begin(), batch.end());
+    q.push_range(values.end(), values.end());
+    EXPECT_EQ(q.size(), values.size());
+
+    mini::ctnr::priority_queue<int, mini::ctnr::vector<int>, std::greater<int>,
+        mini::ctnr::dary_heap_policy<>>
+        min_q;
+    min_q.push_range(values.begin(), values.begin() + 2000);
+    min_q.push_range(values.begin() + 2000, values.end());
+
+    std::vector<int> sorted(values);
+    std::sort(sorted.begin(), sorted.end(), std::greater<int>());
+    for (int x : sorted) {
+        ASSERT_EQ(q.top(), x);
+        q.pop();
+    }
+    for (auto it = sorted.rbegin(); it != sorted.rend(); ++it) {
+        ASSERT_EQ(min_q.top(), *it);
+        min_q.pop();
+    }
+    EXPECT_TRUE(q.empty());
+    EXPECT_TRUE(min_q.empty());
+}
+
+namespace {
+
+struct copy_counted {
+    static int copies;
+
+    std::string name;
+
+    copy_counted() = default;
+
+    explicit copy_counted(std::string s)
+        : name(std::move(s))
+    {}
+
+    copy_counted(const copy_counted& other)
+        : name(other.name)
+    {
+        ++copies;
+    }
+
+    copy_counted(copy_counted&&) = default;
+
+    copy_counted& operator=(const copy_counted& other)
+    {
+        name = other.name;
+        ++copies;
+        return *this;
+    }
+
+    copy_counted& operator=(copy_counted&&) = default;
+
+    bool operator<(const copy_counted& other) const { return name < other.name; }
+};
+
+int copy_counted::copies = 0;
+
+}  // namespace
+
+TEST(mini_container_test, adapter_priority_queue_test_take_top)
+{
+    using priority_queue = mini::ctnr::priority_queue<copy_counted, std::vector<copy_counted>>;
+
+    priority_queue q;
+    for (const char* name : {"delta", "alpha", "echo", "charlie", "bravo"}) {
+        q.push(copy_counted(name));
+    }
+    copy_counted::copies = 0;
+
+    EXPECT_EQ(q.take_top().name, "echo");
+    copy_counted out;
+    q.pop_into(out);
+    EXPECT_EQ(out.name, "delta");
+    EXPECT_EQ(q.take_top().name, "charlie");
+    q.pop_into(out);
+    EXPECT_EQ(out.name, "bravo");
+    EXPECT_EQ(q.size(), 1u);
+    EXPECT_EQ(q.top().name, "alpha");
+    EXPECT_EQ(copy_counted::copies, 0);
+}
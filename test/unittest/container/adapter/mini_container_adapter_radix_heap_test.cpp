@@ -0,0 +1,159 @@
+#include "mini_stl/test/mini_unittest.h"
+
+#include "mini_stl/container/adapter/mini_container_adapter_radix_heap.h"
+#include "mini_stl/functional/mini_functional_base.h"
+
+#include <cstdint>
+#include <cstdlib>
+#include <functional>
+#include <queue>
+#include <string>
+#include <utility>
+#include <vector>
+
+TEST(mini_container_test, adapter_radix_heap_test_basic)
+{
+    using radix_heap = mini::ctnr::radix_heap<unsigned>;
+
+    radix_heap q;
+    EXPECT_TRUE(q.empty());
+    for (unsigned x : {7u, 3u, 3u, 12u, 0u, 1024u, 5u}) {
+        q.push(x);
+    }
+    EXPECT_EQ(q.size(), 7u);
+    for (unsigned x : {0u, 3u, 3u, 5u, 7u}) {
+        EXPECT_EQ(q.top(), x);
+        q.pop();
+    }
+    EXPECT_EQ(q.last_key(), 7u);
+    // keys equal to the last popped one are accepted
+    q.push(7);
+    q.push(8);
+    EXPECT_EQ(q.top(), 7u);
+    q.pop();
+    EXPECT_EQ(q.top(), 8u);
+    q.pop();
+    EXPECT_EQ(q.top(), 12u);
+    q.pop();
+    EXPECT_EQ(q.top(), 1024u);
+    q.pop();
+    EXPECT_TRUE(q.empty());
+
+    q.push(2048);
+    q.push(4096);
+    EXPECT_EQ(q.top(), 2048u);
+    EXPECT_EQ(q.last_key(), 2048u);
+    // a cleared queue accepts any key
+    q.clear();
+    EXPECT_TRUE(q.empty());
+    q.push(1);
+    q.push(0);
+    EXPECT_EQ(q.top(), 0u);
+}
+
+TEST(mini_container_test, adapter_radix_heap_test_extreme_keys)
+{
+    mini::ctnr::radix_heap<uint8_t> small;
+    for (int x : {255, 0, 128, 127, 255, 1}) {
+        small.push(uint8_t(x));
+    }
+    for (int x : {0, 1, 127, 128, 255, 255}) {
+        EXPECT_EQ(small.top(), uint8_t(x));
+        small.pop();
+    }
+
+    mini::ctnr::radix_heap<uint64_t> large;
+    const uint64_t top_bit = uint64_t(1) << 63;
+    large.push(~uint64_t(0));
+    large.push(top_bit);
+    large.push(top_bit - 1);
+    large.push(0);
+    EXPECT_EQ(large.top(), 0u);
+    large.pop();
+    EXPECT_EQ(large.top(), top_bit - 1);
+    large.pop();
+    EXPECT_EQ(large.top(), top_bit);
+    large.pop();
+    EXPECT_EQ(large.top(), ~uint64_t(0));
+    large.pop();
+    EXPECT_TRUE(large.empty());
+}
+
+TEST(mini_container_test, adapter_radix_heap_test_simulation)
+{
+    typedef std::pair<uint64_t, int> event;  // time, id
+    mini::ctnr::radix_heap<event, mini::func::select1st> q;
+    std::priority_queue<uint64_t, std::vector<uint64_t>, std::greater<uint64_t>> expected;
+
+    std::srand(48);
+    uint64_t now = 0;
+    int id = 0;
+    for (int step = 0; step < 50000; ++step) {
+        if (std::rand() % 3 != 0 || q.empty()) {
+            // events are scheduled at or after the current time
+            const uint64_t at = now + uint64_t(std::rand() % (step % 7 == 0 ? 1 << 20 : 64));
+            q.push(event(at, id++));
+            expected.push(at);
+        } else {
+            ASSERT_EQ(q.top().first, expected.top());
+            now = q.top().first;
+            q.pop();
+            expected.pop();
+        }
+        ASSERT_EQ(q.size(), expected.size());
+    }
+    while (!q.empty()) {
+        ASSERT_EQ(q.top().first, expected.top());
+        q.pop();
+        expected.pop();
+    }
+    EXPECT_TRUE(expected.empty());
+}
+
+namespace {
+
+// Counts its copies; the key is the length of the payload
+struct copy_counted {
+    static int copies;
+
+    std::string payload;
+
+    explicit copy_counted(std::string s)
+        : payload(std::move(s))
+    {}
+    copy_counted(const copy_counted& other)
+        : payload(other.payload)
+    {
+        ++copies;
+    }
+    copy_counted(copy_counted&&) noexcept = default;
+    copy_counted& operator=(const copy_counted&) = default;
+    copy_counted& operator=(copy_counted&&) noexcept = default;
+};
+
+int copy_counted::copies = 0;
+
+struct payload_size {
+    uint32_t operator()(const copy_counted& c) const { return uint32_t(c.payload.size()); }
+};
+
+}  // namespace
+
+// Spreading a bucket moves its elements down instead of copying them
+TEST(mini_container_test, adapter_radix_heap_test_refill_moves)
+{
+    mini::ctnr::radix_heap<copy_counted, payload_size, std::vector<copy_counted>> q;
+    test_random rng(48);
+    for (int i = 0; i < 2000; ++i) {
+        q.push(copy_counted(std::string(size_t(rng(3000)), 'x')));
+    }
+    EXPECT_EQ(copy_counted::copies, 2000);  // push() takes a const reference
+
+    size_t last = 0;
+    while (!q.empty()) {
+        ASSERT_LE(last, q.top().payload.size());
+        last = q.top().payload.size();
+        q.pop();
+    }
+    EXPECT_EQ(copy_counted::copies, 2000);
+}
@@ -0,0 +1,127 @@
+#include "mini_stl/test/mini_unittest.h"
+
+#include "mini_stl/container/adapter/mini_container_adapter_spsc_queue.h"
+
+#include <cstdint>
+#include <string>
+#include <thread>
+
+TEST(mini_container_test, adapter_spsc_queue_test_basics)
+{
+    using spsc_queue = mini::ctnr::spsc_queue<int>;
+
+    spsc_queue q(5);
+    EXPECT_EQ(q.capacity(), 8);
+    EXPECT_TRUE(q.empty());
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(&q) % mini::mem::cache_line_size, 0);
+
+    int value = 0;
+    EXPECT_FALSE(q.try_pop(value));
+    for (int i = 0; i < 8; ++i) {
+        EXPECT_TRUE(q.try_push(i));
+    }
+    EXPECT_FALSE(q.try_push(8));  // full
+    EXPECT_EQ(q.size(), 8);
+
+    EXPECT_TRUE(q.try_pop(value));
+    EXPECT_EQ(value, 0);
+    EXPECT_TRUE(q.try_push(8));
+
+    // batch pop across the end of the storage
+    int out[16] = {};
+    EXPECT_EQ(q.try_pop_n(out, 16), 8);
+    for (int i = 0; i < 8; ++i) {
+        EXPECT_EQ(out[i], i + 1);
+    }
+    EXPECT_TRUE(q.empty());
+
+    // batch push is cut at capacity
+    const int in[10] = {10, 11, 12, 13, 14, 15, 16, 17, 18, 19};
+    EXPECT_EQ(q.try_push_n(in, 10), 8);
+    EXPECT_EQ(q.try_push_n(in, 10), 0);
+    EXPECT_EQ(q.try_pop_n(out, 3), 3);
+    EXPECT_EQ(out[2], 12);
+    EXPECT_EQ(q.try_push_n(in + 8, 2), 2);
+    EXPECT_EQ(q.try_pop_n(out, 16), 7);
+    EXPECT_EQ(out[0], 13);
+    EXPECT_EQ(out[6], 19);
+}
+
+TEST(mini_container_test, adapter_spsc_queue_test_nonprimitive_types)
+{
+    using spsc_queue = mini::ctnr::spsc_queue<std::string>;
+
+    spsc_queue q(4);
+    std::string s(100, 'a');
+    EXPECT_TRUE(q.try_push(std::move(s)));
+    EXPECT_TRUE(q.try_emplace(3, 'b'));
+    EXPECT_TRUE(q.try_push("c"));
+
+    std::string value;
+    EXPECT_TRUE(q.try_pop(value));
+    EXPECT_EQ(value.size(), 100);
+
+    std::string out[2];
+    EXPECT_EQ(q.try_pop_n(out, 2), 2);
+    EXPECT_EQ(out[0], "bbb");
+    EXPECT_EQ(out[1], "c");
+
+    // remaining elements are destroyed with the queue
+    EXPECT_TRUE(q.try_push(std::string(50, 'd')));
+}
+
+TEST(mini_container_test, adapter_spsc_queue_test_threads)
+{
+    using spsc_queue = mini::ctnr::spsc_queue<std::uint64_t>;
+
+    const std::uint64_t count = 200000;
+    spsc_queue q(64);
+
+    std::thread producer([&q, count] {
+        std::uint64_t next = 0;
+        std::uint64_t batch[7];
+        while (next < count) {
+            if (next % 3 == 0) {
+                // single push
+                if (q.try_push(next)) {
+                    ++next;
+                } else {
+                    std::this_thread::yield();  // full: let the consumer run
+                }
+            } else {
+                // batch push
+                std::uint64_t n = count - next < 7 ? count - next : 7;
+                for (std::uint64_t i = 0; i < n; ++i) {
+                    batch[i] = next + i;
+                }
+                std::uint64_t pushed = q.try_push_n(batch, n);
+                if (pushed == 0) {
+                    std::this_thread::yield();
+                }
+                next += pushed;
+            }
+        }
+    });
+
+    std::uint64_t expected = 0;
+    bool in_order = true;
+    std::uint64_t batch[5];
+    while (expected < count) {
+        size_t n = q.try_pop_n(batch, 5);
+        for (size_t i = 0; i < n; ++i) {
+            in_order = in_order && batch[i] == expected;
+            ++expected;
+        }
+        std::uint64_t value;
+        if (expected < count && q.try_pop(value)) {
+            in_order = in_order && value == expected;
+            ++expected;
+        } else if (n == 0) {
+            std::this_thread::yield();  // empty: let the producer run
+        }
+    }
+    producer.join();
+
+    EXPECT_TRUE(in_order);
+    EXPECT_TRUE(q.empty());
+}
@@ -0,0 +1,236 @@
+#include "mini_stl/test/mini_unittest.h"
+
+#include "mini_stl/container/adapter/mini_container_adapter_timing_wheel.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <map>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+TEST(mini_container_test, adapter_timing_wheel_test_basic)
+{
+    using timing_wheel = mini::ctnr::timing_wheel<int>;
+
+    timing_wheel w;
+    EXPECT_TRUE(w.empty());
+    const timing_wheel::handle_type a = w.schedule(5, 1);
+    w.schedule(5, 2);
+    const timing_wheel::handle_type c = w.schedule(70, 3);
+    const timing_wheel::handle_type d = w.schedule(100000, 4);
+    w.schedule(0, 5);
+    EXPECT_EQ(w.size(), 5u);
+    EXPECT_EQ(w.expiry(a), 5u);
+    EXPECT_EQ(w.expiry(d), 100000u);
+    EXPECT_EQ(w[c], 3);
+
+    std::vector<int> fired;
+    auto record = [&fired](int& value) { fired.push_back(value); };
+    EXPECT_EQ(w.advance(1, record), 1u);
+    EXPECT_EQ(fired, std::vector<int>({5}));
+    EXPECT_EQ(w.advance(3, record), 0u);
+    EXPECT_EQ(w.now(), 4u);
+    EXPECT_EQ(w.advance(1, record), 2u);
+    std::sort(fired.begin() + 1, fired.end());
+    EXPECT_EQ(fired, std::vector<int>({5, 1, 2}));
+
+    w.cancel(c);
+    w.reschedule(d, 10);
+    EXPECT_EQ(w.expiry(d), 15u);
+    EXPECT_EQ(w.advance(1000000, record), 1u);
+    EXPECT_EQ(fired.back(), 4);
+    EXPECT_EQ(w.now(), 1000005u);
+    EXPECT_TRUE(w.empty());
+}
+
+// Every operation checked against a map of expiries, with delays spanning all levels
+TEST(mini_container_test, adapter_timing_wheel_test_random)
+{
+    using timing_wheel = mini::ctnr::timing_wheel<int>;
+
+    std::srand(49);
+    timing_wheel w(12345);
+    std::map<int, std::pair<timing_wheel::handle_type, uint64_t>> pending;  // id: handle, expiry
+    int next_id = 0;
+    for (int step = 0; step < 20000; ++step) {
+        const int op = std::rand() % 8;
+        const int shift = std::rand() % 5 == 0 ? std::rand() % 40 : std::rand() % 12;
+        const uint64_t delay = uint64_t(std::rand()) % (uint64_t(1) << shift);
+        if (op <= 2 || pending.empty()) {
+            const timing_wheel::handle_type h = w.schedule(delay, next_id);
+            pending[next_id++] = {h, w.now() + (delay != 0 ? delay : 1)};
+        } else if (op <= 4) {
+            auto it = pending.begin();
+            std::advance(it, std::rand() % pending.size());
+            if (op == 3) {
+                w.cancel(it->second.first);
+                pending.erase(it);
+            } else {
+                w.reschedule(it->second.first, delay);
+                it->second.second = w.now() + (delay != 0 ? delay : 1);
+            }
+        } else {
+            const uint64_t ticks = op == 7 ? delay : uint64_t(std::rand() % 64);
+            const uint64_t target = w.now() + ticks;
+            w.advance(ticks, [&](int& id) {
+                auto it = pending.find(id);
+                ASSERT_TRUE(it != pending.end());
+                ASSERT_EQ(it->second.second, w.now());
+                pending.erase(it);
+            });
+            ASSERT_EQ(w.now(), target);
+            for (const auto& entry : pending) {
+                ASSERT_GT(entry.second.second, target);
+            }
+        }
+        ASSERT_EQ(w.size(), pending.size());
+    }
+    w.advance(~uint64_t(0) - w.now(), [&](int& id) { pending.erase(id); });
+    EXPECT_TRUE(pending.empty());
+    EXPECT_TRUE(w.empty());
+}
+
+TEST(mini_container_test, adapter_timing_wheel_test_callbacks)
+{
+    using timing_wheel = mini::ctnr::timing_wheel<std::string>;
+
+    timing_wheel w;
+    std::vector<std::string> fired;
+    timing_wheel::handle_type victim = w.schedule(3, "victim");
+    w.schedule(3, "killer");
+    w.schedule(3, std::string(100, 'x'));
+    // a periodic timer rescheduling itself from its callback, and a cancelled batch mate
+    w.advance(10, [&](std::string& value) {
+        if (value == "killer" && victim) {
+            w.cancel(victim);
+            victim = 0;
+        } else if (value == "victim") {
+            victim = 0;  // ran before 'killer'
+        }
+        if (value.size() < 12) {
+            w.schedule(4, value + "+");
+        }
+        fired.push_back(std::move(value));
+    });
+    EXPECT_EQ(w.now(), 10u);
+    EXPECT_TRUE(std::find(fired.begin(), fired.end(), "killer+") != fired.end());
+    EXPECT_TRUE(std::find(fired.begin(), fired.end(), std::string(100, 'x')) != fired.end());
+    EXPECT_FALSE(w.empty());
+    w.clear();
+    EXPECT_TRUE(w.empty());
+    EXPECT_EQ(w.advance(100, [](std::string&) { FAIL(); }), 0u);
+
+    // a throwing callback leaves the rest of its batch for the next tick
+    for (int i = 0; i < 5; ++i) {
+        w.schedule(2, std::to_string(i));
+    }
+    int calls = 0;
+    EXPECT_THROW(w.advance(5,
+                     [&calls](std::string&) {
+                         if (++calls == 2) {
+                             throw std::runtime_error("callback");
+                         }
+                     }),
+        std::runtime_error);
+    EXPECT_EQ(w.now(), 112u);
+    EXPECT_EQ(w.size(), 3u);
+    EXPECT_EQ(w.advance(1, [](std::string&) {}), 3u);
+    EXPECT_TRUE(w.empty());
+}
+
+TEST(mini_container_test, adapter_timing_wheel_test_clear_from_callback)
+{
+    using timing_wheel = mini::ctnr::timing_wheel<std::string>;
+
+    timing_wheel w;
+    for (int i = 0; i < 5; ++i) {
+        w.schedule(3, std::string(20, char('a' + i)));
+    }
+    w.schedule(10, "later");
+    // the batch mates not run yet are cancelled as well
+    int calls = 0;
+    EXPECT_EQ(w.advance(20,
+                  [&](std::string&) {
+                      ++calls;
+                      w.clear();
+                  }),
+        1u);
+    EXPECT_EQ(calls, 1);
+    EXPECT_TRUE(w.empty());
+    EXPECT_EQ(w.now(), 20u);
+
+    // clear() from a nested advance() reaches the batch of the outer one too
+    for (int i = 0; i < 4; ++i) {
+        w.schedule(1, std::to_string(i));
+        w.schedule(2, std::to_string(i + 10));
+    }
+    calls = 0;
+    w.advance(5, [&](std::string&) {
+        ++calls;
+        w.advance(1, [&](std::string&) {
+            ++calls;
+            w.clear();
+        });
+    });
+    EXPECT_EQ(calls, 2);
+    EXPECT_TRUE(w.empty());
+    w.schedule(1, "again");
+    EXPECT_EQ(w.advance(1, [](std::string& value) { EXPECT_EQ(value, "again"); }), 1u);
+}
+
+TEST(mini_container_test, adapter_timing_wheel_test_own_handle)
+{
+    using timing_wheel = mini::ctnr::timing_wheel<std::string>;
+
+    timing_wheel w;
+    // a periodic timer rescheduling itself, every 10 ticks, 5 times
+    timing_wheel::handle_type periodic = w.schedule(10, std::string(30, 'p'));
+    std::vector<uint64_t> ticks;
+    w.advance(100, [&](std::string& value) {
+        EXPECT_EQ(value, std::string(30, 'p'));
+        ticks.push_back(w.now());
+        if (ticks.size() < 5) {
+            w.reschedule(periodic, 10);
+            EXPECT_EQ(w.size(), 1u);
+        }
+    });
+    EXPECT_EQ(ticks, std::vector<uint64_t>({10, 20, 30, 40, 50}));
+    EXPECT_TRUE(w.empty());
+
+    // cancelling its own timer, before or after rescheduling it, or clearing after it
+    const uint64_t start = w.now();
+    timing_wheel::handle_type self[3];
+    for (int i = 0; i < 3; ++i) {
+        self[i] = w.schedule(1, std::to_string(i));
+    }
+    w.schedule(5, "other");
+    int calls = 0;
+    w.advance(1, [&](std::string& value) {
+        ++calls;
+        const int i = std::stoi(value);
+        if (i == 0) {
+            w.cancel(self[0]);
+        } else if (i == 1) {
+            w.reschedule(self[1], 3);
+            w.cancel(self[1]);
+        } else {
+            w.reschedule(self[2], 3);
+        }
+        EXPECT_EQ(value, std::to_string(i));  // still alive until the callback returns
+    });
+    EXPECT_EQ(calls, 3);
+    EXPECT_EQ(w.size(), 2u);  // "2" again, and "other"
+    EXPECT_EQ(w.advance(3,
+                  [&](std::string& value) {
+                      EXPECT_EQ(value, "2");
+                      w.reschedule(self[2], 1);
+                      w.clear();
+                  }),
+        1u);
+    EXPECT_EQ(w.now(), start + 4);
+    EXPECT_TRUE(w.empty());
+    EXPECT_EQ(w.advance(100, [](std::string&) { FAIL(); }), 0u);
+}
@@ -0,0 +1,155 @@
+#include "mini_stl/test/mini_unittest.h"
+
+#include "mini_stl/container/adapter/mini_container_adapter_queue.h"
+#include "mini_stl/container/adapter/mini_container_adapter_stack.h"
+#include "mini_stl/container/mini_container_circular_buffer.h"
+
+#include <cstring>
+#include <string>
+
+TEST(mini_container_test, circular_buffer_test_basics)
+{
+    using circular_buffer = mini::ctnr::circular_buffer<int>;
+
+    {
+        circular_buffer cb(5);
+        EXPECT_TRUE(cb.empty());
+        EXPECT_EQ(cb.capacity(), 8);  // rounded up to a power of two
+
+        // push/pop at both ends
+        cb.push_back(1);
+        cb.push_back(2);
+        cb.push_front(0);
+        cb.push_front(-1);
+        EXPECT_EQ(cb.size(), 4);
+        EXPECT_EQ(dump(cb), "-1 0 1 2");
+        EXPECT_EQ(cb.front(), -1);
+        EXPECT_EQ(cb.back(), 2);
+        EXPECT_EQ(cb[1], 0);
+
+        cb.pop_front();
+        cb.pop_back();
+        EXPECT_EQ(dump(cb), "0 1");
+
+        // random access iterators
+        for (int i = 2; i < 8; ++i) {
+            cb.push_back(i);
+        }
+        EXPECT_TRUE(cb.full());
+        circular_buffer::iterator it = cb.begin() + 5;
+        EXPECT_EQ(*it, 5);
+        EXPECT_EQ(it[-3], 2);
+        EXPECT_EQ(cb.end() - cb.begin(), 8);
+        EXPECT_TRUE(cb.begin() < it);
+        EXPECT_EQ(*mini::algo::find(cb.begin(), cb.end(), 7), 7);
+
+        // full and not overwriting: grows, order kept
+        cb.push_front(-1);
+        EXPECT_EQ(cb.capacity(), 16);
+        EXPECT_EQ(dump(cb), "-1 0 1 2 3 4 5 6 7");
+
+        try {
+            cb.at(9);
+        } catch (const std::exception& e) {
+            EXPECT_STREQ(
+                e.what(), "mini::ctnr::circular_buffer: out_of_range failure: n >= size()");
+        }
+    }
+
+    {
+        // overwrite mode: a sliding window of the last 4 values
+        circular_buffer window(4, true);
+        for (int i = 0; i < 10; ++i) {
+            window.push_back(i);
+        }
+        EXPECT_EQ(window.capacity(), 4);
+        EXPECT_EQ(dump(window), "6 7 8 9");
+
+        window.push_front(5);  // overwrites the newest element
+        EXPECT_EQ(dump(window), "5 6 7 8");
+
+        circular_buffer copy(window);
+        EXPECT_EQ(copy.capacity(), 4);
+        copy.push_back(9);
+        EXPECT_EQ(dump(copy), "6 7 8 9");
+        EXPECT_EQ(dump(window), "5 6 7 8");
+    }
+}
+
+TEST(mini_container_test, circular_buffer_test_array_ranges)
+{
+    using circular_buffer = mini::ctnr::circular_buffer<int>;
+
+    circular_buffer cb(8, true);
+    for (int i = 0; i < 13; ++i) {
+        cb.push_back(i);
+    }
+    // elements 5..12 start at slot 5 and wrap around
+    circular_buffer::array_range one = cb.array_one();
+    circular_buffer::array_range two = cb.array_two();
+    EXPECT_EQ(one.second, 3);
+    EXPECT_EQ(two.second, 5);
+    EXPECT_EQ(one.first[0], 5);
+    EXPECT_EQ(two.first[0], 8);
+
+    // batch out with two memcpy calls
+    int out[8];
+    std::memcpy(out, one.first, one.second * sizeof(int));
+    std::memcpy(out + one.second, two.first, two.second * sizeof(int));
+    for (int i = 0; i < 8; ++i) {
+        EXPECT_EQ(out[i], 5 + i);
+    }
+
+    cb.erase_begin(one.second);
+    EXPECT_EQ(cb.array_one().second, 5);
+    EXPECT_EQ(cb.array_two().second, 0);
+    cb.erase_end(2);
+    EXPECT_EQ(dump(cb), "8 9 10");
+}
+
+TEST(mini_container_test, circular_buffer_test_nonprimitive_types)
+{
+    using circular_buffer = mini::ctnr::circular_buffer<std::string>;
+
+    circular_buffer cb;
+    EXPECT_EQ(cb.capacity(), 0);
+    for (int i = 0; i < 5; ++i) {
+        cb.emplace_back(i + 1, 'x');
+    }
+    // argument refers to an element of the container during growth
+    cb.push_back(cb.front());
+    EXPECT_EQ(cb.size(), 6);
+    EXPECT_EQ(cb.back(), "x");
+
+    cb.set_overwrite(true);
+    while (!cb.full()) {
+        cb.push_back("y");
+    }
+    cb.push_back(cb.front());  // argument refers to the element being overwritten
+    EXPECT_EQ(cb.back(), "x");
+    EXPECT_EQ(cb.front(), "xx");
+
+    circular_buffer moved(std::move(cb));
+    EXPECT_TRUE(cb.empty());
+    EXPECT_EQ(moved.size(), 8);
+}
+
+TEST(mini_container_test, circular_buffer_test_as_sequence)
+{
+    using circular_buffer = mini::ctnr::circular_buffer<int>;
+
+    mini::ctnr::queue<int, circular_buffer> q;
+    mini::ctnr::stack<int, circular_buffer> s;
+    for (int i = 0; i < 20; ++i) {
+        q.push(i);
+        s.push(i);
+    }
+    for (int i = 0; i < 20; ++i) {
+        EXPECT_EQ(q.front(), i);
+        EXPECT_EQ(s.top(), 19 - i);
+        q.pop();
+        s.pop();
+    }
+    EXPECT_TRUE(q.empty());
+    EXPECT_TRUE(s.empty());
+}
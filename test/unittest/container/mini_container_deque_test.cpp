@@ -3,6 +3,78 @@
 #include "mini_stl/algorithm/mini_algorithm.h"
 #include "mini_stl/container/mini_container_deque.h"
 
+#include <cstdlib>
+#include <string>
+
+namespace {
+
+// malloc-based allocator that counts calls, to observe buffer reuse
+struct counting_alloc {
+    static void* allocate(size_t n)
+    {
+        ++allocations;
+        return std::malloc(n);
+    }
+
+    static void deallocate(void* p, size_t /* n */)
+    {
+        ++deallocations;
+        std::free(p);
+    }
+
+    static size_t allocations;
+    static size_t deallocations;
+};
+
+size_t counting_alloc::allocations = 0;
+size_t counting_alloc::deallocations = 0;
+
+// counts copies, moved-from objects are marked
+struct message {
+    message(int id, std::string body)
+        : id(id)
+        , body(std::move(body))
+    {}
+
+    message(const message& other)
+        : id(other.id)
+        , body(other.body)
+    {
+        ++copies;
+    }
+
+    message(message&& other) noexcept
+        : id(other.id)
+        , body(std::move(other.body))
+    {
+        other.id = -1;
+    }
+
+    message& operator=(const message& other)
+    {
+        id = other.id;
+        body = other.body;
+        ++copies;
+        return *this;
+    }
+
+    message& operator=(message&& other) noexcept
+    {
+        id = other.id;
+        body = std::move(other.body);
+        other.id = -1;
+        return *this;
+    }
+
+    int id;
+    std::string body;
+    static int copies;
+};
+
+int message::copies = 0;
+
+}  // namespace
+
 TEST(mini_container_test, deque_test_basics)
 {
     using value_type = int;
@@ -124,3 +196,195 @@ TEST(mini_container_test, deque_test_advanced)
         EXPECT_EQ(d2.dump(), "-3 0 100 1 6 7 -1");
     }
 }
+
+TEST(mini_container_test, deque_test_buffer_policy)
+{
+    using value_type = int;
+    using allocator = mini::mem::alloc;
+
+    {
+        // 96 bytes hold 24 ints, rounded down to 16 per buffer
+        using policy = mini::iter::deque_buffer_policy<96, true>;
+        using deque = mini::ctnr::deque<value_type, allocator, 0, policy>;
+        EXPECT_EQ(deque::iterator::buffer_size(), 16);
+        EXPECT_TRUE(deque::iterator::power_of_two_buffer);
+
+        deque d(0, 0);
+        for (int i = 0; i < 50; ++i) {
+            d.push_back(i);
+            d.push_front(-i - 1);
+        }
+        EXPECT_EQ(d.size(), 100);
+        for (int i = 0; i < 100; ++i) {
+            EXPECT_EQ(d[i], i - 50);
+        }
+
+        // random access across buffers, forward and backward from the middle of a buffer
+        deque::iterator mid = d.begin() + 57;
+        EXPECT_EQ(*mid, 7);
+        for (int n = -57; n < 43; ++n) {
+            EXPECT_EQ(mid[n], 7 + n);
+            EXPECT_EQ(*(mid + n), 7 + n);
+        }
+        EXPECT_EQ(*(mid - 40), -33);
+        EXPECT_EQ((mid + 30) - (mid - 20), 50);
+    }
+
+    {
+        // the classic layout is kept when power-of-two rounding is off
+        using policy = mini::iter::deque_buffer_policy<96, false>;
+        using deque = mini::ctnr::deque<value_type, allocator, 0, policy>;
+        EXPECT_EQ(deque::iterator::buffer_size(), 24);
+        EXPECT_FALSE(deque::iterator::power_of_two_buffer);
+    }
+
+    {
+        // large elements: the default 512 bytes hold one element, a bigger block holds several
+        struct large {
+            char bytes[300];
+        };
+        using default_deque = mini::ctnr::deque<large, allocator>;
+        using block_deque =
+            mini::ctnr::deque<large, allocator, 0, mini::iter::deque_buffer_policy<4096, true>>;
+        EXPECT_EQ(default_deque::iterator::buffer_size(), 1);
+        EXPECT_EQ(block_deque::iterator::buffer_size(), 8);
+    }
+}
+
+TEST(mini_container_test, deque_test_spare_buffers)
+{
+    using value_type = int;
+    const size_t BUFFER_SIZE = 4;
+    using deque = mini::ctnr::deque<value_type, counting_alloc, BUFFER_SIZE>;
+
+    counting_alloc::allocations = counting_alloc::deallocations = 0;
+    {
+        deque d(0, 0);
+        for (int i = 0; i < 10; ++i) {
+            d.push_back(i);
+        }
+
+        // warm up: the map may grow once before the queue reaches steady state
+        for (int i = 10; i < 100; ++i) {
+            d.pop_front();
+            d.push_back(i);
+        }
+
+        // steady-state FIFO: buffers emptied at the front are reused at the back,
+        // and the map is recentered in place
+        size_t allocations = counting_alloc::allocations;
+        for (int i = 100; i < 1000; ++i) {
+            EXPECT_EQ(d.front(), i - 10);
+            d.pop_front();
+            d.push_back(i);
+        }
+        EXPECT_EQ(counting_alloc::allocations, allocations);
+        EXPECT_EQ(d.size(), 10);
+        EXPECT_EQ(d.dump(), "990 991 992 993 994 995 996 997 998 999");
+
+        // copies are independent
+        deque copy(d);
+        copy.pop_front();
+        copy.push_back(1000);
+        EXPECT_EQ(d.front(), 990);
+        EXPECT_EQ(copy.dump(), "991 992 993 994 995 996 997 998 999 1000");
+
+        d = copy;
+        EXPECT_EQ(d.dump(), copy.dump());
+
+        d.clear();
+        d.shrink_to_fit();
+        EXPECT_TRUE(d.empty());
+    }
+    // every buffer and map is released, including the spare reserve
+    EXPECT_EQ(counting_alloc::allocations, counting_alloc::deallocations);
+}
+
+TEST(mini_container_test, deque_test_emplace_and_move)
+{
+    message::copies = 0;
+
+    const size_t BUFFER_SIZE = 3;
+    using deque = mini::ctnr::deque<message, mini::mem::alloc, BUFFER_SIZE>;
+
+    deque d;
+    d.emplace_back(1, "one");
+    d.emplace_front(0, "zero");
+    message m(2, "two");
+    d.push_back(std::move(m));
+    EXPECT_EQ(m.id, -1);
+    d.push_front(message(-5, "minus"));
+    EXPECT_EQ(d.emplace_back(3, "three").body, "three");
+    EXPECT_EQ(message::copies, 0);
+    EXPECT_EQ(d.size(), 5);
+
+    // emplace in the middle shifts the shorter side by moves only
+    for (int i = 0; i < 10; ++i) {
+        d.emplace_back(10 + i, "x");
+    }
+    deque::iterator it = d.emplace(d.begin() + 2, 100, "hundred");
+    EXPECT_EQ(it->id, 100);
+    EXPECT_EQ(d[1].id, 0);
+    EXPECT_EQ(d[2].id, 100);
+    EXPECT_EQ(d[3].id, 1);
+    it = d.emplace(d.end() - 2, 200, "two hundred");
+    EXPECT_EQ(it->id, 200);
+    EXPECT_EQ(d[d.size() - 4].id, 17);
+    EXPECT_EQ(d[d.size() - 3].id, 200);
+    EXPECT_EQ(d[d.size() - 1].id, 19);
+    EXPECT_EQ(message::copies, 0);
+    EXPECT_EQ(d.size(), 17);
+
+    // the only copies are the ones asked for
+    d.insert(d.begin() + 1, d[0]);
+    EXPECT_EQ(message::copies, 1);
+    EXPECT_EQ(d[1].id, -5);
+}
+
+TEST(mini_container_test, deque_test_range_insert_and_resize)
+{
+    using value_type = int;
+    using allocator = mini::mem::alloc;
+    const size_t BUFFER_SIZE = 4;
+    using deque = mini::ctnr::deque<value_type, allocator, BUFFER_SIZE>;
+
+    const int src[] = {100, 101, 102, 103, 104, 105, 106, 107, 108, 109};
+
+    // insert every count at every position, check against a plain array model
+    for (int len = 0; len <= 9; ++len) {
+        for (int pos = 0; pos <= len; ++pos) {
+            for (int n = 0; n <= 10; n += 3) {
+                deque d;
+                for (int i = 0; i < len; ++i) {
+                    d.push_back(i);
+                }
+                deque::iterator it = d.insert(d.begin() + pos, src, src + n);
+                EXPECT_EQ(it - d.begin(), pos);
+                ASSERT_EQ(d.size(), size_t(len + n));
+                for (int i = 0; i < len + n; ++i) {
+                    int expected = i < pos ? i : (i < pos + n ? src[i - pos] : i - n);
+                    EXPECT_EQ(d[i], expected) << "len=" << len << " pos=" << pos << " n=" << n;
+                }
+            }
+        }
+    }
+
+    // range of deque iterators (forward iterators that are not pointers)
+    deque d;
+    for (int i = 0; i < 6; ++i) {
+        d.push_back(i);
+    }
+    deque other(3, 7);
+    d.insert(d.begin() + 4, other.begin(), other.end());
+    EXPECT_EQ(d.dump(), "0 1 2 3 7 7 7 4 5");
+
+    d.resize(3);
+    EXPECT_EQ(d.dump(), "0 1 2");
+    d.resize(11, 9);
+    EXPECT_EQ(d.dump(), "0 1 2 9 9 9 9 9 9 9 9");
+    EXPECT_EQ(d.back(), 9);
+    d.resize(0);
+    EXPECT_TRUE(d.empty());
+    d.push_back(1);
+    EXPECT_EQ(d.dump(), "1");
+}
@@ -0,0 +1,169 @@
+#include "mini_stl/test/mini_unittest.h"
+
+#include "mini_stl/container/mini_container_eytzinger_array.h"
+#include "mini_stl/container/mini_container_list.h"
+#include "mini_stl/container/mini_container_vector.h"
+#include "mini_stl/functional/mini_functional.h"
+#include "mini_stl/iterator/adapter/mini_iterator_back_insert_iterator.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace {
+
+// Throws on the n-th copy
+struct throwing {
+    static int copies_left;
+    static int alive;
+
+    int value;
+
+    throwing(int v)
+        : value(v)
+    {
+        ++alive;
+    }
+
+    throwing(const throwing& other)
+        : value(other.value)
+    {
+        if (copies_left-- == 0) {
+            throw 1;
+        }
+        ++alive;
+    }
+
+    ~throwing() { --alive; }
+
+    bool operator<(const throwing& other) const { return value < other.value; }
+};
+
+int throwing::copies_left = -1;
+int throwing::alive = 0;
+
+}  // namespace
+
+TEST(mini_container_test, eytzinger_array_test_lookup)
+{
+    using eytzinger_array = mini::ctnr::eytzinger_array<int>;
+
+    for (size_t n : {0, 1, 2, 3, 4, 5, 6, 7, 8, 15, 16, 17, 100, 1000, 5000}) {
+        std::vector<int> v = sorted_values(n, uint32_t(n + 1));
+        const eytzinger_array ea(v.data(), v.data() + n);
+        ASSERT_EQ(ea.size(), n);
+        ASSERT_EQ(ea.empty(), n == 0);
+        ASSERT_EQ(size_t(ea.end() - ea.begin()), n);
+
+        // the same values, and the BFS layout is a heap-ordered search tree
+        std::vector<int> values(ea.begin(), ea.end());
+        std::sort(values.begin(), values.end());
+        ASSERT_EQ(values, v);
+        for (size_t k = 2; k <= n; ++k) {
+            const int child = ea.begin()[k - 1];
+            const int parent = ea.begin()[k / 2 - 1];
+            ASSERT_TRUE(k % 2 == 0 ? !(parent < child) : !(child < parent)) << n << " " << k;
+        }
+
+        for (int key = -1; key <= int(n) + 1; ++key) {
+            auto lower = std::lower_bound(v.begin(), v.end(), key);
+            auto upper = std::upper_bound(v.begin(), v.end(), key);
+            auto it = ea.lower_bound(key);
+            if (lower == v.end()) {
+                ASSERT_EQ(it, ea.end()) << n << " " << key;
+            } else {
+                ASSERT_NE(it, ea.end()) << n << " " << key;
+                ASSERT_EQ(*it, *lower) << n << " " << key;
+            }
+            it = ea.upper_bound(key);
+            if (upper == v.end()) {
+                ASSERT_EQ(it, ea.end()) << n << " " << key;
+            } else {
+                ASSERT_NE(it, ea.end()) << n << " " << key;
+                ASSERT_EQ(*it, *upper) << n << " " << key;
+            }
+            ASSERT_EQ(ea.contains(key), std::binary_search(v.begin(), v.end(), key));
+            ASSERT_EQ(ea.find(key) != ea.end(), ea.contains(key));
+        }
+    }
+}
+
+TEST(mini_container_test, eytzinger_array_test_batch)
+{
+    using eytzinger_array = mini::ctnr::eytzinger_array<int>;
+
+    for (size_t n : {0, 1, 2, 6, 7, 8, 100, 1023, 1024, 3000}) {
+        std::vector<int> v = sorted_values(n, uint32_t(2 * n + 1));
+        const eytzinger_array ea(v.data(), v.data() + n);
+
+        // not a multiple of the batch size
+        std::vector<int> keys = sorted_values(77, uint32_t(2 * n + 3), uint32_t(n));
+        std::reverse(keys.begin(), keys.end());
+        keys.push_back(-1);
+
+        mini::ctnr::vector<const int*> lowers(keys.size()), uppers(keys.size());
+        EXPECT_EQ(ea.batch_lower_bound(keys.data(), keys.data() + keys.size(), lowers.begin()),
+            lowers.end());
+        EXPECT_EQ(ea.batch_upper_bound(keys.data(), keys.data() + keys.size(), uppers.begin()),
+            uppers.end());
+        for (size_t i = 0; i < keys.size(); ++i) {
+            ASSERT_EQ(lowers[i], ea.lower_bound(keys[i])) << n << " " << keys[i];
+            ASSERT_EQ(uppers[i], ea.upper_bound(keys[i])) << n << " " << keys[i];
+        }
+    }
+
+    // keys from a list
+    std::vector<int> v = sorted_values(50, 100);
+    const eytzinger_array ea(v.data(), v.data() + v.size());
+    mini::ctnr::list<int> keys;
+    for (int key : {5, 50, 99, 100}) {
+        keys.push_back(key);
+    }
+    mini::ctnr::vector<const int*> found;
+    ea.batch_lower_bound(keys.begin(), keys.end(), mini::iter::back_inserter(found));
+    ASSERT_EQ(found.size(), 4);
+    EXPECT_EQ(found[0], ea.lower_bound(5));
+    EXPECT_EQ(found[3], ea.lower_bound(100));
+}
+
+TEST(mini_container_test, eytzinger_array_test_objects)
+{
+    using eytzinger_array =
+        mini::ctnr::eytzinger_array<std::string, mini::func::greater<std::string>>;
+
+    // sorted by the comparator: descending
+    std::vector<std::string> words = {"pear", "lime", "kiwi", "fig", "date", "apple"};
+    eytzinger_array ea(words.data(), words.data() + words.size());
+    EXPECT_EQ(*ea.lower_bound("lemon"), "kiwi");
+    EXPECT_EQ(*ea.upper_bound("kiwi"), "fig");
+    EXPECT_EQ(ea.lower_bound("aardvark"), ea.end());
+    EXPECT_EQ(*ea.lower_bound("zucchini"), "pear");
+    EXPECT_TRUE(ea.contains("fig"));
+    EXPECT_FALSE(ea.contains("grape"));
+
+    // copy, move, assignment
+    eytzinger_array copy(ea);
+    EXPECT_EQ(copy.size(), 6);
+    EXPECT_TRUE(copy.contains("date"));
+    eytzinger_array moved(std::move(copy));
+    EXPECT_TRUE(copy.empty());
+    EXPECT_EQ(copy.lower_bound("date"), copy.end());
+    EXPECT_TRUE(moved.contains("apple"));
+    copy = moved;
+    EXPECT_TRUE(copy.contains("lime"));
+    moved = eytzinger_array();
+    EXPECT_TRUE(moved.empty());
+    EXPECT_TRUE(copy.contains("pear"));
+
+    // a throwing copy destroys the values built so far
+    std::vector<throwing> values;
+    for (int i = 0; i < 20; ++i) {
+        values.push_back(throwing(i));
+    }
+    const int alive = throwing::alive;
+    throwing::copies_left = 11;
+    EXPECT_THROW(mini::ctnr::eytzinger_array<throwing>(values.data(), values.data() + 20), int);
+    EXPECT_EQ(throwing::alive, alive);
+    throwing::copies_left = -1;
+}
@@ -0,0 +1,84 @@
+#include "mini_stl/test/mini_unittest.h"
+
+#include "mini_stl/container/mini_container_mmap_vector.h"
+
+#include <cstdio>
+#include <string>
+
+namespace {
+
+struct record {
+    int id;
+    double price;
+};
+
+}  // namespace
+
+TEST(mini_container_test, mmap_vector_test_basics)
+{
+    using value_type = record;
+    using mmap_vector = mini::ctnr::mmap_vector<value_type>;
+    const std::string path = testing::TempDir() + "mini_mmap_vector_test.bin";
+
+    {
+        // create and grow through ftruncate + mremap
+        mmap_vector v(path.c_str(), mmap_vector::open_mode::create);
+        EXPECT_TRUE(v.is_open());
+        EXPECT_TRUE(v.empty());
+
+        for (int i = 0; i < 10000; ++i) {
+            v.push_back(record{i, i * 0.5});
+        }
+        EXPECT_EQ(v.size(), 10000);
+        EXPECT_GE(v.capacity(), 10000);
+        EXPECT_EQ(v[9999].id, 9999);
+        EXPECT_EQ(v.back().price, 9999 * 0.5);
+        v.flush();
+
+        v.pop_back();
+        EXPECT_EQ(v.size(), 9999);
+    }
+
+    {
+        // zero-copy read-only open: file was trimmed to size() elements on close
+        mmap_vector v(path.c_str(), mmap_vector::open_mode::read_only);
+        EXPECT_TRUE(v.read_only());
+        EXPECT_EQ(v.size(), 9999);
+        EXPECT_EQ(v.capacity(), 9999);
+        EXPECT_EQ(v[1234].id, 1234);
+        EXPECT_EQ(v[1234].price, 617.0);
+
+        try {
+            v.push_back(record{0, 0});
+        } catch (const std::exception& e) {
+            EXPECT_STREQ(e.what(), "mini::ctnr::mmap_vector: container is read-only");
+        }
+    }
+
+    {
+        // reopen for writing and resize
+        mmap_vector v(path.c_str());
+        EXPECT_EQ(v.size(), 9999);
+        v.resize(3);
+        EXPECT_EQ(v.size(), 3);
+        v.resize(5, record{-1, -1.0});
+        EXPECT_EQ(v[2].id, 2);
+        EXPECT_EQ(v[4].id, -1);
+
+        mmap_vector moved(std::move(v));
+        EXPECT_FALSE(v.is_open());
+        EXPECT_EQ(moved.size(), 5);
+        moved.shrink_to_fit();
+        EXPECT_EQ(moved.capacity(), 5);
+        moved.close();
+        EXPECT_FALSE(moved.is_open());
+    }
+
+    {
+        mmap_vector v(path.c_str(), mmap_vector::open_mode::read_only);
+        EXPECT_EQ(v.size(), 5);
+        EXPECT_EQ(v.back().id, -1);
+    }
+
+    std::remove(path.c_str());
+}
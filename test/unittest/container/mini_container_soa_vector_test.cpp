@@ -0,0 +1,102 @@
+#include "mini_stl/test/mini_unittest.h"
+
+#include "mini_stl/container/mini_container_soa_vector.h"
+
+#include <string>
+
+TEST(mini_container_test, soa_vector_test_basics)
+{
+    using soa_vector = mini::ctnr::soa_vector<int, double, char>;
+
+    {
+        soa_vector v;
+        EXPECT_TRUE(v.empty());
+        EXPECT_EQ(v.size(), 0);
+        EXPECT_EQ(v.capacity(), 0);
+
+        v.push_back(1, 1.5, 'a');
+        v.push_back(2, 2.5, 'b');
+        v.push_back(3, 3.5, 'c');
+        EXPECT_EQ(v.size(), 3);
+        EXPECT_EQ(v.capacity(), 4);
+
+        // tuple-like proxy reference
+        auto [i, d, c] = v[1];
+        EXPECT_EQ(i, 2);
+        EXPECT_EQ(d, 2.5);
+        EXPECT_EQ(c, 'b');
+        std::get<0>(v[1]) = 20;
+        EXPECT_EQ(v.get<0>(1), 20);
+
+        // columns are contiguous and share the size
+        auto ints = v.column<0>();
+        EXPECT_EQ(ints.size(), 3);
+        EXPECT_EQ(dump(ints), "1 20 3");
+        EXPECT_EQ(dump(v.column<2>()), "a b c");
+        EXPECT_EQ(v.data<1>() + 1, &v.get<1>(1));
+
+        // out-of-range access
+        try {
+            v.at(3);
+        } catch (const std::exception& e) {
+            EXPECT_STREQ(e.what(), "mini::ctnr::soa_vector: out_of_range failure: n >= size()");
+        }
+    }
+
+    {
+        soa_vector v;
+        v.reserve(8);
+        EXPECT_EQ(v.capacity(), 8);
+        for (int i = 0; i < 6; ++i) {
+            v.push_back(i, i * 0.5, char('a' + i));
+        }
+
+        // erase keeps all columns in sync
+        EXPECT_EQ(v.erase(1), 1);
+        EXPECT_EQ(dump(v.column<0>()), "0 2 3 4 5");
+        EXPECT_EQ(dump(v.column<2>()), "a c d e f");
+
+        EXPECT_EQ(v.erase(1, 3), 1);
+        EXPECT_EQ(dump(v.column<0>()), "0 4 5");
+        EXPECT_EQ(dump(v.column<1>()), "0 2 2.5");
+        EXPECT_EQ(dump(v.column<2>()), "a e f");
+
+        v.pop_back();
+        EXPECT_EQ(v.size(), 2);
+        EXPECT_EQ(std::get<2>(v.back()), 'e');
+
+        v.resize(4);
+        EXPECT_EQ(dump(v.column<0>()), "0 4 0 0");
+
+        v.clear();
+        EXPECT_TRUE(v.empty());
+        EXPECT_EQ(v.capacity(), 8);
+    }
+}
+
+TEST(mini_container_test, soa_vector_test_nonprimitive_types)
+{
+    using soa_vector = mini::ctnr::soa_vector<std::string, int>;
+
+    soa_vector v;
+    for (int i = 0; i < 5; ++i) {
+        v.push_back(std::string(i + 1, 'x'), i);
+    }
+    // argument refers to an element of the container during reallocation
+    v.push_back(v.get<0>(4), 5);
+    EXPECT_EQ(v.size(), 6);
+    EXPECT_EQ(v.get<0>(5), "xxxxx");
+
+    soa_vector copy(v);
+    v.erase(0, 4);
+    EXPECT_EQ(dump(v.column<0>()), "xxxxx xxxxx");
+    EXPECT_EQ(dump(copy.column<0>()), "x xx xxx xxxx xxxxx xxxxx");
+    EXPECT_EQ(dump(copy.column<1>()), "0 1 2 3 4 5");
+
+    soa_vector moved(std::move(copy));
+    EXPECT_TRUE(copy.empty());
+    EXPECT_EQ(moved.size(), 6);
+
+    v = moved;
+    EXPECT_EQ(dump(v.column<1>()), "0 1 2 3 4 5");
+}
@@ -3,6 +3,8 @@
 #include "mini_stl/container/mini_container_vector.h"
 
 #include <algorithm>
+#include <string>
+#include <utility>
 
 TEST(mini_container_test, vector_test_primitive_types)
 {
@@ -174,3 +176,23 @@ TEST(mini_container_test, vector_test_nonprimive_types)
         EXPECT_TRUE(std::equal(vec.begin(), vec.end(), vec2.begin(), vec2.end()));
     }
 }
+
+TEST(mini_container_test, vector_test_push_back_rvalue)
+{
+    // the buffer of a moved string follows it, whether the vector grows or not
+    mini::ctnr::vector<std::string> vec;
+    std::string first(100, 'x');
+    const char* data = first.data();
+    vec.push_back(std::move(first));  // capacity 0: reallocates
+    EXPECT_EQ(vec[0].data(), data);
+    EXPECT_TRUE(first.empty());
+
+    vec.push_back(std::string(50, 'y'));
+    vec.push_back(std::string(50, 'y'));  // capacity 4 now
+    std::string last(60, 'z');
+    data = last.data();
+    vec.push_back(std::move(last));
+    EXPECT_EQ(vec.size(), 4u);
+    EXPECT_EQ(vec[3].data(), data);
+    EXPECT_EQ(vec[3], std::string(60, 'z'));
+}
@@ -0,0 +1,106 @@
+#include "mini_stl/test/mini_unittest.h"
+
+#include "mini_stl/container/mini_container_work_stealing_deque.h"
+
+#include <atomic>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+TEST(mini_container_test, work_stealing_deque_test_basics)
+{
+    using work_stealing_deque = mini::ctnr::work_stealing_deque<int>;
+
+    work_stealing_deque d(3);
+    EXPECT_EQ(d.capacity(), 4);
+    EXPECT_TRUE(d.empty());
+
+    int value = 0;
+    EXPECT_FALSE(d.pop(value));
+    EXPECT_FALSE(d.steal(value));
+
+    // owner pops LIFO, thieves steal FIFO
+    for (int i = 0; i < 10; ++i) {
+        d.push(i);
+    }
+    EXPECT_EQ(d.size(), 10);
+    EXPECT_EQ(d.capacity(), 16);  // grown twice
+
+    EXPECT_TRUE(d.pop(value));
+    EXPECT_EQ(value, 9);
+    EXPECT_TRUE(d.steal(value));
+    EXPECT_EQ(value, 0);
+    EXPECT_TRUE(d.steal(value));
+    EXPECT_EQ(value, 1);
+    EXPECT_TRUE(d.pop(value));
+    EXPECT_EQ(value, 8);
+    EXPECT_EQ(d.size(), 6);
+
+    // indices keep running across the circular array
+    for (int i = 0; i < 100; ++i) {
+        d.push(i);
+        EXPECT_TRUE(d.steal(value));
+    }
+    std::vector<int> rest;
+    while (d.pop(value)) {
+        rest.push_back(value);
+    }
+    EXPECT_EQ(dump(rest), "99 98 97 96 95 94");
+    EXPECT_EQ(d.capacity(), 16);
+}
+
+TEST(mini_container_test, work_stealing_deque_test_threads)
+{
+    using work_stealing_deque = mini::ctnr::work_stealing_deque<std::uint64_t>;
+
+    const int thieves = 3;
+    const std::uint64_t count = 100000;
+    work_stealing_deque d(2);  // small start: growth happens while thieves are stealing
+
+    std::atomic<bool> done(false);
+    std::atomic<std::uint64_t> stolen_sum(0);
+    std::atomic<std::uint64_t> stolen_count(0);
+    std::vector<std::thread> threads;
+    for (int i = 0; i < thieves; ++i) {
+        threads.emplace_back([&] {
+            std::uint64_t sum = 0;
+            std::uint64_t n = 0;
+            std::uint64_t value;
+            while (!done.load()) {
+                if (d.steal(value)) {
+                    sum += value;
+                    ++n;
+                } else {
+                    std::this_thread::yield();
+                }
+            }
+            stolen_sum += sum;
+            stolen_count += n;
+        });
+    }
+
+    // owner: pushes everything, popping every third step
+    std::uint64_t popped_sum = 0;
+    std::uint64_t popped_count = 0;
+    std::uint64_t value;
+    for (std::uint64_t i = 0; i < count; ++i) {
+        d.push(i);
+        if (i % 3 == 0 && d.pop(value)) {
+            popped_sum += value;
+            ++popped_count;
+        }
+    }
+    while (d.pop(value)) {
+        popped_sum += value;
+        ++popped_count;
+    }
+    done = true;
+    for (std::thread& t : threads) {
+        t.join();
+    }
+
+    // every element was taken exactly once
+    EXPECT_EQ(popped_count + stolen_count.load(), count);
+    EXPECT_EQ(popped_sum + stolen_sum.load(), count * (count - 1) / 2);
+    EXPECT_TRUE(d.empty());
+}
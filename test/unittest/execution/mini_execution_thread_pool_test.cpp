@@ -0,0 +1,176 @@
+#include "mini_stl/test/mini_unittest.h"
+
+#include "mini_stl/execution/mini_execution.h"
+
+#include <atomic>
+#include <future>
+#include <numeric>
+#include <stdexcept>
+#include <vector>
+
+TEST(mini_execution_test, thread_pool_test_submit)
+{
+    mini::exec::thread_pool pool(2);
+    EXPECT_EQ(pool.size(), 2);
+    EXPECT_FALSE(pool.in_worker());
+
+    std::vector<std::future<int>> results;
+    for (int i = 0; i < 100; ++i) {
+        results.push_back(pool.submit([i] { return i * i; }));
+    }
+    for (int i = 0; i < 100; ++i) {
+        EXPECT_EQ(results[i].get(), i * i);
+    }
+
+    // exceptions travel through the future
+    std::future<void> failed = pool.submit([] { throw std::runtime_error("task"); });
+    EXPECT_THROW(failed.get(), std::runtime_error);
+
+    // tasks run on the workers, unless a waiting thread helps
+    std::future<bool> inside = pool.submit([&pool] { return pool.in_worker(); });
+    EXPECT_TRUE(inside.get());
+    std::future<int> helped = pool.submit([] { return 7; });
+    pool.wait(helped);
+    EXPECT_EQ(helped.get(), 7);
+}
+
+TEST(mini_execution_test, thread_pool_test_drain_on_destruction)
+{
+    std::atomic<int> count(0);
+    {
+        mini::exec::thread_pool pool(2);
+        for (int i = 0; i < 1000; ++i) {
+            pool.execute([&count] { count.fetch_add(1, std::memory_order_relaxed); });
+        }
+    }
+    EXPECT_EQ(count.load(), 1000);
+}
+
+TEST(mini_execution_test, task_group_test_nested)
+{
+    mini::exec::thread_pool pool(2);
+
+    // every task spawns and waits for its own group: waits must help instead of block
+    std::atomic<int> leaves(0);
+    mini::exec::task_group outer(pool);
+    for (int i = 0; i < 8; ++i) {
+        outer.run([&pool, &leaves] {
+            mini::exec::task_group inner(pool);
+            for (int j = 0; j < 8; ++j) {
+                inner.run([&leaves] { leaves.fetch_add(1, std::memory_order_relaxed); });
+            }
+            inner.wait();
+        });
+    }
+    outer.wait();
+    EXPECT_EQ(leaves.load(), 64);
+
+    // the first exception is rethrown once, the group is reusable afterwards
+    outer.run([] { throw std::logic_error("first"); });
+    outer.run([] {});
+    EXPECT_THROW(outer.wait(), std::logic_error);
+    EXPECT_NO_THROW(outer.wait());
+}
+
+namespace {
+
+// A function object that cannot be copied into a task
+struct copy_throws {
+    copy_throws() = default;
+    copy_throws(const copy_throws&) { throw std::runtime_error("copy"); }
+    copy_throws(copy_throws&&) noexcept = default;
+
+    void operator()() const {}
+};
+
+}  // namespace
+
+TEST(mini_execution_test, task_group_test_failed_run)
+{
+    mini::exec::thread_pool pool(2);
+    const copy_throws f;
+    {
+        // a task that never got queued is not waited for
+        mini::exec::task_group group(pool);
+        EXPECT_THROW(group.run(f), std::runtime_error);
+        group.run([] {});
+        group.wait();
+        EXPECT_THROW(group.run(f), std::runtime_error);
+    }
+    // nor counted by the pool, which can still drain and stop
+    EXPECT_THROW(pool.execute(f), std::runtime_error);
+    EXPECT_FALSE(pool.run_one());
+}
+
+TEST(mini_execution_test, parallel_for_test)
+{
+    mini::exec::thread_pool pool(3);
+
+    // integer range: every index visited exactly once, pieces no larger than the grain
+    std::vector<std::atomic<int>> visits(10000);
+    std::atomic<bool> oversized(false);
+    mini::exec::parallel_for(pool, 0, 10000, 64, [&](int first, int last) {
+        if (last - first > 64) {
+            oversized = true;
+        }
+        for (int i = first; i < last; ++i) {
+            visits[i].fetch_add(1, std::memory_order_relaxed);
+        }
+    });
+    EXPECT_FALSE(oversized.load());
+    for (int i = 0; i < 10000; ++i) {
+        ASSERT_EQ(visits[i].load(), 1);
+    }
+
+    // iterator range
+    std::vector<long> v(5000);
+    std::iota(v.begin(), v.end(), 1);
+    std::atomic<long> sum(0);
+    typedef std::vector<long>::iterator iterator;
+    mini::exec::parallel_for(pool, v.begin(), v.end(), 100, [&sum](iterator first, iterator last) {
+        sum.fetch_add(std::accumulate(first, last, 0L), std::memory_order_relaxed);
+    });
+    EXPECT_EQ(sum.load(), 5000L * 5001 / 2);
+
+    // empty range and grain 0
+    int calls = 0;
+    mini::exec::parallel_for(pool, 5, 5, 10, [&calls](int, int) { ++calls; });
+    EXPECT_EQ(calls, 0);
+    std::atomic<int> pieces(0);
+    mini::exec::parallel_for(pool, 0, 16, 0, [&pieces](int first, int last) {
+        EXPECT_EQ(last - first, 1);
+        pieces.fetch_add(1);
+    });
+    EXPECT_EQ(pieces.load(), 16);
+
+    // exceptions reach the caller
+    EXPECT_THROW(mini::exec::parallel_for(pool, 0, 1000, 10,
+                     [](int first, int) {
+                         if (first >= 500) {
+                             throw std::out_of_range("piece");
+                         }
+                     }),
+        std::out_of_range);
+
+    // default pool
+    std::atomic<int> total(0);
+    mini::exec::parallel_for(0, 1000, 50, [&total](int first, int last) {
+        total.fetch_add(last - first, std::memory_order_relaxed);
+    });
+    EXPECT_EQ(total.load(), 1000);
+}
+
+TEST(mini_execution_test, parallel_invoke_test)
+{
+    int a = 0;
+    int b = 0;
+    int c = 0;
+    mini::exec::parallel_invoke([&a] { a = 1; }, [&b] { b = 2; }, [&c] { c = 3; });
+    EXPECT_EQ(a + b + c, 6);
+
+    mini::exec::parallel_invoke([&a] { a = 10; });
+    EXPECT_EQ(a, 10);
+
+    EXPECT_THROW(mini::exec::parallel_invoke([] {}, [] { throw std::runtime_error("second"); }),
+        std::runtime_error);
+}
@@ -4,6 +4,8 @@
 #include "mini_stl/memory/mini_memory_defalloc.h"
 
 #include <algorithm>
+#include <new>
+#include <stdexcept>
 #include <vector>
 
 TEST(mini_memory_test, defalloc_test_vec_primitive_type)
@@ -75,3 +77,48 @@ TEST(mini_memory_test, alloc_test_primitive_type)
         EXPECT_EQ((ptr3 - ptr2), 1);
     }
 }
+
+namespace {
+
+// counts live objects, the 4th move construction throws
+struct move_tracked {
+    explicit move_tracked(int v)
+        : value(v)
+    {
+        ++live;
+    }
+    move_tracked(move_tracked&& other)
+        : value(other.value)
+    {
+        if (++moves == 4) {
+            throw std::runtime_error("move");
+        }
+        ++live;
+    }
+    ~move_tracked() { --live; }
+
+    int value;
+    static inline int live = 0;
+    static inline int moves = 0;
+};
+
+}  // namespace
+
+TEST(mini_memory_test, uninitialized_move_test_rollback)
+{
+    {
+        std::vector<move_tracked> src;
+        src.reserve(6);
+        for (int i = 0; i < 6; ++i) {
+            src.emplace_back(i);
+        }
+        void* raw = ::operator new(6 * sizeof(move_tracked));
+        move_tracked* dst = static_cast<move_tracked*>(raw);
+        EXPECT_THROW(
+            mini::mem::uninitialized_move(src.begin(), src.end(), dst), std::runtime_error);
+        // the 3 elements built before the failure are destroyed again
+        EXPECT_EQ(move_tracked::live, 6);
+        ::operator delete(raw);
+    }
+    EXPECT_EQ(move_tracked::live, 0);
+}